@@ -0,0 +1,66 @@
+// File:  alignedAllocator.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Standard library allocator returning aligned memory.
+
+#ifndef ALIGNED_ALLOCATOR_H_
+#define ALIGNED_ALLOCATOR_H_
+
+// Standard C++ headers
+#include <cstdlib>
+#include <cstddef>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif// _WIN32
+
+/// Allocator for use with standard containers which aligns every allocation
+/// to the specified boundary (i.e. a cache line, or the widest vector
+/// register).
+template <typename T, size_t Alignment = 64>
+class AlignedAllocator
+{
+public:
+	typedef T value_type;
+
+	template <typename U>
+	struct rebind
+	{
+		typedef AlignedAllocator<U, Alignment> other;
+	};
+
+	AlignedAllocator() = default;
+	template <typename U>
+	AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+	T* allocate(const size_t& count)
+	{
+		void* p(nullptr);
+#ifdef _WIN32
+		p = _aligned_malloc(count * sizeof(T), Alignment);
+#else
+		if (posix_memalign(&p, Alignment, count * sizeof(T)) != 0)
+			p = nullptr;
+#endif// _WIN32
+		if (!p)
+			throw std::bad_alloc();
+		return static_cast<T*>(p);
+	}
+
+	void deallocate(T* p, const size_t&)
+	{
+#ifdef _WIN32
+		_aligned_free(p);
+#else
+		free(p);
+#endif// _WIN32
+	}
+
+	template <typename U>
+	bool operator==(const AlignedAllocator<U, Alignment>&) const { return true; }
+	template <typename U>
+	bool operator!=(const AlignedAllocator<U, Alignment>&) const { return false; }
+};
+
+#endif// ALIGNED_ALLOCATOR_H_
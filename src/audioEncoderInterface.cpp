@@ -5,7 +5,6 @@
 
 // Local headers
 #include "audioEncoderInterface.h"
-#include "soundData.h"
 #include "muxer.h"
 
 // FFmpeg
@@ -15,7 +14,7 @@
 // Standard C++ headers
 #include <iostream>
 
-bool AudioEncoderInterface::Encode(const std::string& outputFileName, const std::unique_ptr<SoundData>& soundData, const int& bitRate)
+bool AudioEncoderInterface::Encode(const std::string& outputFileName, const SoundDataView& soundData, const int& bitRate)
 {
 	const auto lastDot(outputFileName.find_last_of('.'));
 	if (lastDot == std::string::npos)
@@ -34,7 +33,7 @@ bool AudioEncoderInterface::Encode(const std::string& outputFileName, const std:
 			return AV_CODEC_ID_PCM_F32LE;// Chosen so we don't need to resample
 		return muxer.GetAudioCodecs().front();
 	}());
-	if (!encoder.Initialize(muxer.GetOutputFormatContext(), 1, static_cast<int>(soundData->GetSampleRate()), bitRate, AV_SAMPLE_FMT_FLTP, codecID))
+	if (!encoder.Initialize(muxer.GetOutputFormatContext(), 1, static_cast<int>(soundData.GetSampleRate()), bitRate, AV_SAMPLE_FMT_FLTP, codecID))
 		return false;
 
 	std::queue<AVPacket*> encodedAudio;
@@ -48,9 +47,9 @@ bool AudioEncoderInterface::Encode(const std::string& outputFileName, const std:
 	unsigned int startSample(0);
 	while (true)
 	{
-		if (startSample <= soundData->GetData().GetNumberOfPoints())
+		if (startSample <= soundData.GetNumberOfPoints())
 		{
-			SoundToAVFrame(startSample, *soundData, encoder.GetFrameSize(), encoder.inputFrame);
+			SoundToAVFrame(startSample, soundData, encoder.GetFrameSize(), encoder.inputFrame);
 			startSample += encoder.GetFrameSize();
 		}
 		else
@@ -103,14 +102,14 @@ void AudioEncoderInterface::FreeQueuedPackets(std::queue<AVPacket*>& q)
 	}
 }
 
-void AudioEncoderInterface::SoundToAVFrame(const unsigned int& startSample, const SoundData& soundData, const unsigned int& frameSize, AVFrame*& frame) const
+void AudioEncoderInterface::SoundToAVFrame(const unsigned int& startSample, const SoundDataView& soundData, const unsigned int& frameSize, AVFrame*& frame) const
 {
-	if (startSample + frameSize > soundData.GetData().GetNumberOfPoints())
+	if (startSample + frameSize > soundData.GetNumberOfPoints())
 	{
 		memset(frame->data[0], 0, frameSize * sizeof(float));
-		const auto valuesToCopy(soundData.GetData().GetNumberOfPoints() - startSample);
-		memcpy(frame->data[0], soundData.GetData().GetY().data() + startSample, valuesToCopy * sizeof(float));
+		const auto valuesToCopy(soundData.GetNumberOfPoints() - startSample);
+		memcpy(frame->data[0], soundData.GetSamples() + startSample, valuesToCopy * sizeof(float));
 	}
 	else
-		memcpy(frame->data[0], soundData.GetData().GetY().data() + startSample, frameSize * sizeof(float));
+		memcpy(frame->data[0], soundData.GetSamples() + startSample, frameSize * sizeof(float));
 }
@@ -8,25 +8,23 @@
 
 // Local headers
 #include "audioEncoder.h"
+#include "soundDataView.h"
 
 // Standard C++ headers
 #include <queue>
 #include <memory>
 
-// Local forward declarations
-class SoundData;
-
 // FFmpeg forward declarations
 struct AVPacket;
 
 class AudioEncoderInterface
 {
 public:
-	bool Encode(const std::string& outputFileName, const std::unique_ptr<SoundData>& soundData, const int& bitRate);
+	bool Encode(const std::string& outputFileName, const SoundDataView& soundData, const int& bitRate);
 
 private:
 	void FreeQueuedPackets(std::queue<AVPacket*>& q);
-	void SoundToAVFrame(const unsigned int& startSample, const SoundData& soundData, const unsigned int& frameSize, AVFrame*& frame) const;
+	void SoundToAVFrame(const unsigned int& startSample, const SoundDataView& soundData, const unsigned int& frameSize, AVFrame*& frame) const;
 };
 
 #endif// AUDIO_ENCODER_INTERFACE_H_
@@ -382,10 +382,6 @@ bool AudioFile::ReadAudioFile(AVFormatContext& formatContext, AVCodecContext& co
 	}
 
 	dataInsertionPoint = 0;
-	/*std::generate(data->data.GetX().begin(), data->data.GetX().end(), [n = 0.0, this]() mutable
-	{
-		return n++ / fileInfo.sampleRate;
-	});*/// Apparently, this bit isn't required
 
 	int returnCode(0);
 	while (returnCode != AVERROR_EOF)
@@ -452,20 +448,16 @@ bool AudioFile::ReadAudioFile(AVFormatContext& formatContext, AVCodecContext& co
 void AudioFile::AppendFrame(const AVFrame& frame)
 {
 	const float* floatData(reinterpret_cast<float*>(frame.data[0]));// Because we resampled to FLTP
-	const size_t samplesToAdd(std::min(static_cast<size_t>(frame.nb_samples), data->GetData().GetNumberOfPoints() - dataInsertionPoint));
-	std::copy(floatData, floatData + samplesToAdd, data->GetData().GetY().begin() + dataInsertionPoint);
+	auto& samples(data->GetSamples());
+	const size_t samplesToAdd(std::min(static_cast<size_t>(frame.nb_samples), samples.size() - dataInsertionPoint));
+	std::copy(floatData, floatData + samplesToAdd, samples.begin() + dataInsertionPoint);
 
 	if (samplesToAdd < static_cast<size_t>(frame.nb_samples))
-	{
-		data->GetData().GetY().insert(data->GetData().GetY().end(), floatData + samplesToAdd, floatData + frame.nb_samples);
-		data->GetData().GetX().resize(data->GetData().GetY().size());
-	}
+		samples.insert(samples.end(), floatData + samplesToAdd, floatData + frame.nb_samples);
 	dataInsertionPoint += frame.nb_samples;
 }
 
 void AudioFile::ZeroFillUnusedData()
 {
-	unsigned int i;
-	for (i = dataInsertionPoint; i < data->GetData().GetNumberOfPoints(); ++i)
-		data->GetData().GetY()[i] = 0.0;
+	std::fill(data->GetSamples().begin() + dataInsertionPoint, data->GetSamples().end(), 0.0f);
 }
@@ -43,7 +43,7 @@ AudioRenderer::AudioDeviceList AudioRenderer::GetPlaybackDevices()
 	return deviceList;
 }
 
-void AudioRenderer::Play(const SoundData& soundData)
+void AudioRenderer::Play(const SoundDataView& soundData)
 {
 	std::lock_guard<std::mutex> lock(mutex);
 	state = State::Playing;
@@ -91,7 +91,7 @@ void AudioRenderer::RenderLoop()
 	desiredSpec.freq = static_cast<int>(data->GetSampleRate());
 	desiredSpec.channels = 1;
 	desiredSpec.silence = 0;
-	desiredSpec.samples = 4096;// static_cast<uint16_t>(data->GetData().GetNumberOfPoints());
+	desiredSpec.samples = 4096;// static_cast<uint16_t>(data->GetNumberOfPoints());
 	desiredSpec.format = AUDIO_F32;
 
 	SDL_AudioSpec obtainedSpec;
@@ -107,12 +107,12 @@ void AudioRenderer::RenderLoop()
 
 	assert(desiredSpec.format == obtainedSpec.format);
 
-	std::vector<float> renderData(data->GetData().GetNumberOfPoints() * obtainedSpec.channels);
+	std::vector<float> renderData(data->GetNumberOfPoints() * obtainedSpec.channels);
 	assert(desiredSpec.channels == 1);
-	for (size_t i = 0; i < data->GetData().GetNumberOfPoints(); ++i)
+	for (size_t i = 0; i < data->GetNumberOfPoints(); ++i)
 	{
 		for (unsigned int j = 0; j < obtainedSpec.channels; ++j)
-			renderData[obtainedSpec.channels * i + j] = data->GetData().GetY()[i];
+			renderData[obtainedSpec.channels * i + j] = data->GetSamples()[i];
 	}
 
 	SDL_ClearQueuedAudio(outputDevice);
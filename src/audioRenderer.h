@@ -27,7 +27,7 @@ public:
 	AudioRenderer(wxEvtHandler* appEventHandler);
 	~AudioRenderer();
 
-	void Play(const SoundData& soundData);
+	void Play(const SoundDataView& soundData);
 	void Resume();
 	void Pause();
 	void Stop();
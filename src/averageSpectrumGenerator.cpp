@@ -0,0 +1,105 @@
+// File:  averageSpectrumGenerator.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Class for generating images of the average spectrum of a selection.
+
+// Local headers
+#include "averageSpectrumGenerator.h"
+
+// wxWidgets headers
+#include <wx/image.h>
+#include <wx/dcmemory.h>
+
+// Standard C++ headers
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <cassert>
+
+const double AverageSpectrumGenerator::dynamicRange(80.0);
+const double AverageSpectrumGenerator::overlap(0.5);
+
+AverageSpectrumGenerator::AverageSpectrumGenerator(const std::shared_ptr<const Density>& density, const DatasetType& sampleRate,
+	const SonogramGenerator::FFTParameters& parameters) : density(density), sampleRate(sampleRate), parameters(parameters)
+{
+	assert(density);
+}
+
+std::shared_ptr<const AverageSpectrumGenerator::Density> AverageSpectrumGenerator::ComputeDensity(const SoundDataView& soundData,
+	const SonogramGenerator::FFTParameters& parameters)
+{
+	auto density(std::make_shared<Density>(FastFourierTransform::ComputePowerSpectralDensity(soundData.GetSamples(),
+		soundData.GetNumberOfPoints(), soundData.GetSampleRate(), parameters.windowFunction, parameters.windowSize, overlap, true)));
+
+	const DatasetType smallestDensity(std::numeric_limits<DatasetType>::min());
+	for (auto& d : *density)
+		d = static_cast<DatasetType>(10.0 * log10(std::max(d, smallestDensity)));
+
+	return density;
+}
+
+double AverageSpectrumGenerator::GetPeakDensity(const double& minFrequency, const double& maxFrequency) const
+{
+	const double binWidth(static_cast<double>(sampleRate) / parameters.windowSize);// [Hz]
+	const double lastBin(static_cast<double>(density->size() - 1));
+	const double minBin(std::min(std::max(minFrequency / binWidth, 0.0), lastBin));
+	const double maxBin(std::min(std::max(maxFrequency / binWidth, 0.0), lastBin));
+
+	// Use the largest bin within the range so narrow peaks aren't lost when
+	// there are more bins than pixels
+	const auto first(static_cast<size_t>(ceil(minBin)));
+	const auto last(static_cast<size_t>(floor(maxBin)));
+	if (first <= last)
+		return *std::max_element(density->begin() + first, density->begin() + last + 1);
+
+	// Otherwise, interpolate between the bins on either side of the range
+	const double bin(0.5 * (minBin + maxBin));
+	const auto lower(static_cast<size_t>(floor(bin)));
+	const double fraction(bin - lower);
+	return (*density)[lower] + fraction * ((*density)[lower + 1] - (*density)[lower]);
+}
+
+wxImage AverageSpectrumGenerator::GetImage(const unsigned int& width, const unsigned int& height, const wxColor& backgroundColor, const wxColor& lineColor) const
+{
+	const unsigned int colorDepth(24);
+	wxBitmap spectrum(width, height, colorDepth);
+
+	// Polygon bounded by the left edge of the image and the density curve
+	std::vector<wxPoint> pointList;
+	if (density->size() > 1 && height > 0 && parameters.maxFrequency > parameters.minFrequency)
+	{
+		// Each row covers a slice of the frequency range, with the maximum frequency at the top
+		const double rowHeight((parameters.maxFrequency - parameters.minFrequency) / height);// [Hz/px]
+		std::vector<double> rowDensity(height);
+		for (unsigned int i = 0; i < height; ++i)
+			rowDensity[i] = GetPeakDensity(parameters.maxFrequency - (i + 1) * rowHeight, parameters.maxFrequency - i * rowHeight);
+
+		const double floorDensity(*std::max_element(rowDensity.begin(), rowDensity.end()) - dynamicRange);
+
+		pointList.resize(height + 2);
+		for (unsigned int i = 0; i < height; ++i)
+		{
+			const double fraction(std::min(std::max((rowDensity[i] - floorDensity) / dynamicRange, 0.0), 1.0));
+			pointList[i] = wxPoint(fraction * (width - 1), i);
+		}
+		pointList[height] = wxPoint(0, height - 1);
+		pointList[height + 1] = wxPoint(0, 0);
+	}
+
+	{
+		wxMemoryDC dc;
+		dc.SelectObject(spectrum);
+		dc.SetBackground(backgroundColor);
+		dc.Clear();
+
+		wxPen pen(lineColor);
+		dc.SetPen(pen);
+		wxBrush brush(lineColor);
+		dc.SetBrush(brush);
+
+		if (!pointList.empty())
+			dc.DrawPolygon(pointList.size(), pointList.data());
+	}
+
+	return spectrum.ConvertToImage();
+}
@@ -0,0 +1,54 @@
+// File:  averageSpectrumGenerator.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Class for generating images of the average spectrum of a selection.
+
+#ifndef AVERAGE_SPECTRUM_GENERATOR_H_
+#define AVERAGE_SPECTRUM_GENERATOR_H_
+
+// wxWidgets headers
+#include <wx/colour.h>// Can't forward declare due to marcro (color vs. coulour)
+
+// Local headers
+#include "soundDataView.h"
+#include "sonogramGenerator.h"
+
+// Standard C++ headers
+#include <vector>
+#include <memory>
+
+// wxWidgets forward declarations
+class wxImage;
+
+// Draws the Welch power spectral density of the data with frequency on the
+// vertical axis (increasing upward, covering the same range as the sonogram)
+// and power [dB] on the horizontal axis (increasing to the right).  The
+// density is computed separately (see ComputeDensity()) so it can be reused
+// when only display settings change.
+class AverageSpectrumGenerator
+{
+public:
+	typedef std::vector<DatasetType> Density;// [dB], bins 0 through windowSize / 2
+
+	AverageSpectrumGenerator(const std::shared_ptr<const Density>& density, const DatasetType& sampleRate,
+		const SonogramGenerator::FFTParameters& parameters);
+
+	// Depends only on the data, window function and window size; segments
+	// always overlap by the fixed Welch overlap, independent of the sonogram
+	static std::shared_ptr<const Density> ComputeDensity(const SoundDataView& soundData, const SonogramGenerator::FFTParameters& parameters);
+
+	wxImage GetImage(const unsigned int& width, const unsigned int& height, const wxColor& backgroundColor, const wxColor& lineColor) const;
+
+	static const double overlap;
+
+private:
+	static const double dynamicRange;// [dB]
+
+	const std::shared_ptr<const Density> density;
+	const DatasetType sampleRate;// [Hz]
+	const SonogramGenerator::FFTParameters parameters;
+
+	double GetPeakDensity(const double& minFrequency, const double& maxFrequency) const;
+};
+
+#endif// AVERAGE_SPECTRUM_GENERATOR_H_
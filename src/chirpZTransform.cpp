@@ -0,0 +1,224 @@
+// File:  chirpZTransform.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Band-limited spectrum computed with the chirp-z transform.
+
+// Local headers
+#include "chirpZTransform.h"
+
+// Standard C++ headers
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+
+//=============================================================================
+// Class:			ChirpZTransform
+// Function:		ChirpZTransform
+//
+// Description:		Constructor for ChirpZTransform class.  For bin spacing
+//					d (as a fraction of the sample rate) and first bin f0, the
+//					input chirp is exp(-i * (2 * pi * f0 * n + pi * d * n^2))
+//					and the convolution chirp is exp(i * pi * d * m^2) for
+//					m = -(N - 1) through M - 1 (negative indices wrap to the
+//					end of the buffer).  Phases are computed in double
+//					precision and reduced to a fraction of a cycle before
+//					being converted to radians.
+//
+// Input Arguments:
+//		windowSize		= const size_t&
+//		window			= const FastFourierTransform::WindowType&
+//		sampleRate		= const double& [Hz]
+//		minFrequency	= const double& [Hz]
+//		maxFrequency	= const double& [Hz]
+//		binCount		= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+ChirpZTransform::ChirpZTransform(const size_t& windowSize, const FastFourierTransform::WindowType& window,
+	const double& sampleRate, const double& minFrequency, const double& maxFrequency,
+	const size_t& binCount) : windowSize(windowSize), binCount(binCount), firstBinIsDC(minFrequency == 0.0),
+	plan(FFTPlan::Get(2 * ComputeConvolutionSize(windowSize + binCount - 1), FastFourierTransform::WindowType::Uniform))
+{
+	assert(windowSize > 0 && binCount > 0);
+	assert(maxFrequency > minFrequency);
+
+	const double spacing((maxFrequency - minFrequency) / binCount / sampleRate);
+	const double start(minFrequency / sampleRate);
+	const auto windowCoefficients(FastFourierTransform::GetWindowCoefficients(window, windowSize));
+
+	chirpReal.resize(windowSize);
+	chirpImaginary.resize(windowSize);
+	size_t n;
+	for (n = 0; n < windowSize; ++n)
+	{
+		const double cycles(start * n + 0.5 * spacing * n * n);
+		const double angle(-2.0 * M_PI * (cycles - floor(cycles)));
+		chirpReal[n] = static_cast<DatasetType>((*windowCoefficients)[n] * cos(angle));
+		chirpImaginary[n] = static_cast<DatasetType>((*windowCoefficients)[n] * sin(angle));
+	}
+
+	const size_t convolutionSize(plan->GetSize() / 2);
+	std::vector<DatasetType> real(convolutionSize, 0.0f), imaginary(convolutionSize, 0.0f);
+	const auto setChirp([spacing, &real, &imaginary](const size_t& m, const size_t& index)
+	{
+		const double cycles(0.5 * spacing * m * m);
+		const double angle(2.0 * M_PI * (cycles - floor(cycles)));
+		real[index] = static_cast<DatasetType>(cos(angle));
+		imaginary[index] = static_cast<DatasetType>(sin(angle));
+	});
+
+	size_t m;
+	for (m = 0; m < binCount; ++m)
+		setChirp(m, m);
+	for (m = 1; m < windowSize; ++m)
+		setChirp(m, convolutionSize - m);
+
+	plan->ExecuteComplex(real.data(), imaginary.data());
+
+	// Fold in the inverse transform scaling and the single-sided amplitude scaling
+	const double scale(2.0 / windowSize / convolutionSize);
+	responseReal.resize(convolutionSize);
+	responseImaginary.resize(convolutionSize);
+	for (m = 0; m < convolutionSize; ++m)
+	{
+		responseReal[m] = static_cast<DatasetType>(real[m] * scale);
+		responseImaginary[m] = static_cast<DatasetType>(imaginary[m] * scale);
+	}
+}
+
+ChirpZTransform::Workspace::Workspace(const ChirpZTransform& transform)
+	: real(transform.responseReal.size()), imaginary(transform.responseImaginary.size())
+{
+}
+
+//=============================================================================
+// Class:			ChirpZTransform
+// Function:		ComputeConvolutionSize (static)
+//
+// Description:		Returns the smallest power of two which is at least the
+//					specified size (and at least two).
+//
+// Input Arguments:
+//		minimumSize	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		size_t
+//
+//=============================================================================
+size_t ChirpZTransform::ComputeConvolutionSize(const size_t& minimumSize)
+{
+	size_t size(2);
+	while (size < minimumSize)
+		size <<= 1;
+	return size;
+}
+
+//=============================================================================
+// Class:			ChirpZTransform
+// Function:		Compute
+//
+// Description:		Computes the amplitude spectra of frameCount frames,
+//					beginning hopSize samples apart.
+//
+// Input Arguments:
+//		samples			= const DatasetType*
+//		sampleCount		= const size_t&
+//		hopSize			= const size_t&
+//		frameCount		= const size_t&
+//		workspace		= Workspace&
+//		outputStride	= const size_t&
+//
+// Output Arguments:
+//		output			= DatasetType*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void ChirpZTransform::Compute(const DatasetType* samples, const size_t& sampleCount,
+	const size_t& hopSize, const size_t& frameCount, Workspace& workspace,
+	DatasetType* output, const size_t& outputStride) const
+{
+	assert(hopSize > 0);
+	assert(outputStride >= binCount);
+
+	size_t i;
+	for (i = 0; i < frameCount; ++i)
+	{
+		DatasetType* frameOutput(output + i * outputStride);
+		const size_t start(i * hopSize);
+		if (start + windowSize > sampleCount)
+			std::fill(frameOutput, frameOutput + binCount, static_cast<DatasetType>(0.0));
+		else
+			ComputeFrame(samples + start, workspace, frameOutput);
+	}
+}
+
+//=============================================================================
+// Class:			ChirpZTransform
+// Function:		ComputeFrame
+//
+// Description:		Computes the amplitude spectrum of one frame.  The inverse
+//					transform of the product of spectra is computed as the
+//					forward transform of its conjugate; this conjugates the
+//					result, which does not change the magnitude.
+//
+// Input Arguments:
+//		frame		= const DatasetType*
+//		workspace	= Workspace&
+//
+// Output Arguments:
+//		output		= DatasetType*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void ChirpZTransform::ComputeFrame(const DatasetType* frame, Workspace& workspace,
+	DatasetType* output) const
+{
+	assert(workspace.real.size() == responseReal.size());
+
+	double sum(0.0);
+	size_t i;
+	for (i = 0; i < windowSize; ++i)
+		sum += frame[i];
+	const DatasetType mean(static_cast<DatasetType>(sum / windowSize));
+
+	DatasetType* real(workspace.real.data());
+	DatasetType* imaginary(workspace.imaginary.data());
+	for (i = 0; i < windowSize; ++i)
+	{
+		real[i] = (frame[i] - mean) * chirpReal[i];
+		imaginary[i] = (frame[i] - mean) * chirpImaginary[i];
+	}
+
+	std::fill(workspace.real.begin() + windowSize, workspace.real.end(), static_cast<DatasetType>(0.0));
+	std::fill(workspace.imaginary.begin() + windowSize, workspace.imaginary.end(), static_cast<DatasetType>(0.0));
+	plan->ExecuteComplex(real, imaginary);
+
+	const size_t convolutionSize(workspace.real.size());
+	for (i = 0; i < convolutionSize; ++i)
+	{
+		const DatasetType productReal(real[i] * responseReal[i] - imaginary[i] * responseImaginary[i]);
+		const DatasetType productImaginary(real[i] * responseImaginary[i] + imaginary[i] * responseReal[i]);
+		real[i] = productReal;
+		imaginary[i] = -productImaginary;
+	}
+
+	plan->ExecuteComplex(real, imaginary);
+
+	for (i = 0; i < binCount; ++i)
+		output[i] = sqrt(real[i] * real[i] + imaginary[i] * imaginary[i]);
+
+	if (firstBinIsDC)
+		output[0] *= static_cast<DatasetType>(0.5);// No factor of 2 for DC point
+}
@@ -0,0 +1,118 @@
+// File:  chirpZTransform.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Band-limited spectrum computed with the chirp-z transform.
+
+#ifndef CHIRP_Z_TRANSFORM_H_
+#define CHIRP_Z_TRANSFORM_H_
+
+// Local headers
+#include "fftPlan.h"
+
+// Standard C++ headers
+#include <vector>
+#include <memory>
+
+/// Class for computing the amplitude spectrum of a frame at evenly spaced
+/// frequencies within a band, with any spacing (i.e. independent of the frame
+/// size).  Uses Bluestein's algorithm:  With nk = (n^2 + k^2 - (k - n)^2) / 2,
+/// the transform becomes a convolution of the frame (multiplied by a chirp)
+/// with a second chirp, which is computed with two complex FFTs of at least
+/// N + M - 1 points for N samples and M bins.  Only magnitudes are computed,
+/// so the final chirp multiplication (which does not affect the magnitude) is
+/// omitted.
+///
+/// Tables are computed once by the constructor and are not modified, so a
+/// single object may be shared between threads; each caller must provide its
+/// own Workspace.
+class ChirpZTransform
+{
+public:
+	/// Constructor.
+	///
+	/// \param windowSize    Number of samples in each frame.
+	/// \param window        Window function to apply to each frame.
+	/// \param sampleRate    [Hz]
+	/// \param minFrequency  Frequency of the first bin [Hz].
+	/// \param maxFrequency  Upper edge of the band [Hz]; the last bin is one
+	///                      bin spacing below this frequency.
+	/// \param binCount      Number of frequency bins.
+	ChirpZTransform(const size_t& windowSize, const FastFourierTransform::WindowType& window,
+		const double& sampleRate, const double& minFrequency, const double& maxFrequency,
+		const size_t& binCount);
+
+	/// Scratch buffers used when computing a frame.
+	struct Workspace
+	{
+		/// Constructor.
+		///
+		/// \param transform Transform with which this workspace will be used.
+		explicit Workspace(const ChirpZTransform& transform);
+
+		std::vector<DatasetType> real;///< Convolution buffer
+		std::vector<DatasetType> imaginary;///< Convolution buffer
+	};
+
+	/// Computes the amplitude spectra of a series of frames (scaled the same
+	/// as ShortTimeFourierTransform).  The mean of each frame is removed
+	/// prior to windowing.  Frames which would extend beyond the end of the
+	/// sample buffer are filled with zeros.
+	///
+	/// \param samples      Sample buffer.
+	/// \param sampleCount  Number of points in \p samples.
+	/// \param hopSize      Number of samples between the starts of
+	///                     adjacent frames.
+	/// \param frameCount   Number of frames to compute.
+	/// \param workspace    Workspace created for this transform.
+	/// \param output       Output matrix; frame i bin j is written to
+	///                     output[i * outputStride + j].
+	/// \param outputStride Distance between the starts of adjacent frames in
+	///                     \p output (must be at least GetNumberOfBins()).
+	void Compute(const DatasetType* samples, const size_t& sampleCount,
+		const size_t& hopSize, const size_t& frameCount, Workspace& workspace,
+		DatasetType* output, const size_t& outputStride) const;
+
+	/// Computes the amplitude spectrum of one frame.
+	///
+	/// \param frame     Array of GetWindowSize() samples.
+	/// \param workspace Workspace created for this transform.
+	/// \param output    Array of at least GetNumberOfBins() elements.
+	void ComputeFrame(const DatasetType* frame, Workspace& workspace,
+		DatasetType* output) const;
+
+	/// Returns the number of points in each of the complex FFTs used to
+	/// compute a frame.
+	///
+	/// \param minimumSize Number of points in the linear convolution (the
+	///                    window size plus the number of bins, minus one).
+	///
+	/// \returns The smallest power of two which is at least \p minimumSize
+	///          (and at least two).
+	static size_t ComputeConvolutionSize(const size_t& minimumSize);
+
+	/// \name Private data accessors
+	/// @{
+
+	size_t GetWindowSize() const { return windowSize; }
+	size_t GetNumberOfBins() const { return binCount; }
+
+	/// @}
+
+private:
+	const size_t windowSize;
+	const size_t binCount;
+	const bool firstBinIsDC;
+
+	// Complex transform size is half the plan size
+	const std::shared_ptr<const FFTPlan> plan;
+
+	// Window multiplied by the chirp applied to the input
+	std::vector<DatasetType> chirpReal;
+	std::vector<DatasetType> chirpImaginary;
+
+	// Spectrum of the chirp with which the input is convolved (including all scaling)
+	std::vector<DatasetType> responseReal;
+	std::vector<DatasetType> responseImaginary;
+};
+
+#endif// CHIRP_Z_TRANSFORM_H_
@@ -0,0 +1,162 @@
+// File:  fastConvolution.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  FFT-based convolution for applying long FIR filters.
+
+// Local headers
+#include "fastConvolution.h"
+
+// Standard C++ headers
+#include <algorithm>
+#include <cassert>
+
+// Below this, FFT overhead outweighs the savings
+const size_t FastConvolution::minimumPartitionSize(64);
+
+// Longer impulse responses use more partitions rather than larger FFTs
+const size_t FastConvolution::maximumPartitionSize(4096);
+
+FastConvolution::FastConvolution(const std::vector<double>& impulseResponse)
+	: length(impulseResponse.size()), partitionSize(ComputePartitionSize(length)),
+	plan(FFTPlan::Get(2 * partitionSize, FastFourierTransform::WindowType::Uniform))
+{
+	assert(length > 0);
+
+	const size_t partitionCount((length + partitionSize - 1) / partitionSize);
+	partitionReal.resize(partitionCount);
+	partitionImaginary.resize(partitionCount);
+
+	FFTPlan::Workspace workspace(*plan);
+	std::vector<DatasetType> padded(plan->GetSize());
+	size_t p;
+	for (p = 0; p < partitionCount; ++p)
+	{
+		const auto start(impulseResponse.begin() + p * partitionSize);
+		const auto end(impulseResponse.begin() + std::min((p + 1) * partitionSize, length));
+		std::fill(std::copy(start, end, padded.begin()), padded.end(), 0.0f);
+
+		plan->Execute(padded.data(), 0.0, workspace);
+		partitionReal[p] = workspace.real;
+		partitionImaginary[p] = workspace.imaginary;
+	}
+}
+
+//=============================================================================
+// Class:			FastConvolution
+// Function:		ComputePartitionSize (static)
+//
+// Description:		Chooses the partition size for an impulse response of
+//					the specified length.  Short impulse responses use a
+//					single partition.
+//
+// Input Arguments:
+//		length	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		size_t, a power of two
+//
+//=============================================================================
+size_t FastConvolution::ComputePartitionSize(const size_t& length)
+{
+	size_t size(minimumPartitionSize);
+	while (size < length && size < maximumPartitionSize)
+		size <<= 1;
+	return size;
+}
+
+//=============================================================================
+// Class:			FastConvolution
+// Function:		Process
+//
+// Description:		Convolves the input with the impulse response.  For each
+//					block of B samples, the FFT of the block and the previous
+//					block is computed and stored in a ring of spectra.  The
+//					spectrum of the output block is the sum of the products
+//					of partition p with the spectrum computed p blocks ago;
+//					the last B samples of its inverse FFT are the output.
+//
+// Input Arguments:
+//		input			= const DatasetType*
+//		count			= const size_t&
+//		history			= const DatasetType*
+//		historyCount	= const size_t&
+//
+// Output Arguments:
+//		output			= DatasetType*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FastConvolution::Process(const DatasetType* input, DatasetType* output, const size_t& count,
+	const DatasetType* history, const size_t& historyCount) const
+{
+	if (count == 0)
+		return;
+
+	const size_t blockSize(partitionSize);
+	const size_t binCount(plan->GetNumberOfBins());
+	const size_t partitionCount(partitionReal.size());
+
+	// Samples preceding the input which are required to fill the ring
+	std::vector<DatasetType> preceding(partitionCount * blockSize,
+		historyCount > 0 ? history[0] : input[0]);
+	const size_t knownCount(std::min(historyCount, preceding.size()));
+	std::copy(history + historyCount - knownCount, history + historyCount, preceding.end() - knownCount);
+
+	FFTPlan::Workspace workspace(*plan);
+	std::vector<std::vector<DatasetType>> ringReal(partitionCount);
+	std::vector<std::vector<DatasetType>> ringImaginary(partitionCount);
+
+	// The block d blocks before the start of the input is stored in slot P - d
+	size_t p;
+	for (p = 1; p < partitionCount; ++p)
+	{
+		plan->Execute(preceding.data() + (p - 1) * blockSize, 0.0, workspace);
+		ringReal[p] = workspace.real;
+		ringImaginary[p] = workspace.imaginary;
+	}
+
+	// First half is the previous block, second half is the current block
+	std::vector<DatasetType> window(2 * blockSize);
+	std::copy(preceding.end() - blockSize, preceding.end(), window.begin());
+
+	std::vector<DatasetType> result(2 * blockSize);
+	size_t current(0), blockStart, i;
+	for (blockStart = 0; blockStart < count; blockStart += blockSize)
+	{
+		// Samples beyond the end of the input do not affect the output
+		const size_t n(std::min(blockSize, count - blockStart));
+		std::copy(input + blockStart, input + blockStart + n, window.begin() + blockSize);
+		std::fill(window.begin() + blockSize + n, window.end(), 0.0f);
+
+		plan->Execute(window.data(), 0.0, workspace);
+		ringReal[current] = workspace.real;
+		ringImaginary[current] = workspace.imaginary;
+
+		std::fill(workspace.real.begin(), workspace.real.end(), 0.0f);
+		std::fill(workspace.imaginary.begin(), workspace.imaginary.end(), 0.0f);
+		for (p = 0; p < partitionCount; ++p)
+		{
+			const size_t slot((current + partitionCount - p) % partitionCount);
+			const DatasetType* xReal(ringReal[slot].data());
+			const DatasetType* xImaginary(ringImaginary[slot].data());
+			const DatasetType* hReal(partitionReal[p].data());
+			const DatasetType* hImaginary(partitionImaginary[p].data());
+			for (i = 0; i < binCount; ++i)
+			{
+				workspace.real[i] += xReal[i] * hReal[i] - xImaginary[i] * hImaginary[i];
+				workspace.imaginary[i] += xReal[i] * hImaginary[i] + xImaginary[i] * hReal[i];
+			}
+		}
+
+		plan->ExecuteInverse(workspace, result.data());
+		std::copy(result.begin() + blockSize, result.begin() + blockSize + n, output + blockStart);
+
+		std::copy(window.begin() + blockSize, window.end(), window.begin());
+		current = (current + 1) % partitionCount;
+	}
+}
@@ -0,0 +1,76 @@
+// File:  fastConvolution.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  FFT-based convolution for applying long FIR filters.
+
+#ifndef FAST_CONVOLUTION_H_
+#define FAST_CONVOLUTION_H_
+
+// Local headers
+#include "fftPlan.h"
+
+// Standard C++ headers
+#include <vector>
+#include <memory>
+
+/// Class for convolving a signal with a (long) impulse response using
+/// uniformly partitioned overlap-save.  The impulse response is divided into
+/// partitions of B samples, and the signal is processed in blocks of B
+/// samples with FFTs of size 2B.  The spectrum of each input block is
+/// retained for as many blocks as there are partitions, so the cost per
+/// sample is O(log B) plus one complex multiply per partition, compared with
+/// one multiply per tap for direct convolution.  Limiting the partition size
+/// keeps the FFTs (and scratch memory) small for very long impulse
+/// responses.
+///
+/// Processing is const, so a single object may be shared between threads.
+class FastConvolution
+{
+public:
+	/// Constructor.
+	///
+	/// \param impulseResponse Filter coefficients (the coefficient applied to
+	///                        the current input is first).
+	explicit FastConvolution(const std::vector<double>& impulseResponse);
+
+	/// Convolves the specified samples with the impulse response.  The result
+	/// is the same as applying the equivalent FIR Filter, including its
+	/// initialization:  Samples preceding \p input are taken from
+	/// \p history, and any earlier samples are assumed to be equal to the
+	/// first sample of \p history (or of \p input, if no history is
+	/// provided).
+	///
+	/// \param input        Samples to filter.
+	/// \param output       Location to store filtered samples.  May be the
+	///                     same as \p input.
+	/// \param count        Number of samples in \p input and \p output.
+	/// \param history      Samples immediately preceding \p input, oldest
+	///                     first.  May be nullptr if \p historyCount is zero.
+	/// \param historyCount Number of samples in \p history.
+	void Process(const DatasetType* input, DatasetType* output, const size_t& count,
+		const DatasetType* history = nullptr, const size_t& historyCount = 0) const;
+
+	/// \name Private data accessors
+	/// @{
+
+	size_t GetLength() const { return length; }
+	size_t GetPartitionSize() const { return partitionSize; }
+
+	/// @}
+
+private:
+	static const size_t minimumPartitionSize;// [samples]
+	static const size_t maximumPartitionSize;// [samples]
+
+	const size_t length;// [samples]
+	const size_t partitionSize;// [samples]
+	const std::shared_ptr<const FFTPlan> plan;// Size is twice the partition size
+
+	// Spectra of each partition of the impulse response (bins 0 through B)
+	std::vector<std::vector<DatasetType>> partitionReal;
+	std::vector<std::vector<DatasetType>> partitionImaginary;
+
+	static size_t ComputePartitionSize(const size_t& length);
+};
+
+#endif// FAST_CONVOLUTION_H_
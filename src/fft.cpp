@@ -14,9 +14,14 @@
 // Standard C++ headers
 #include <cmath>
 #include <algorithm>
+#include <cassert>
+#include <list>
+#include <mutex>
+#include <utility>
 
 // Local headers
 #include "fft.h"
+#include "fftPlan.h"
 
 //=============================================================================
 // Class:			FastFourierTransform
@@ -50,9 +55,9 @@ std::unique_ptr<Dataset2D> FastFourierTransform::ComputeFFT(const Dataset2D& dat
 //					contains all specifiable parameters.
 //
 // Input Arguments:
-//		data			= Dataset2D referring to the data of interest
+//		data			= const Dataset2D& referring to the data of interest
 //		window			= const WindowType&
-//		windowSize		= unsigned int, number of points in each sample;
+//		windowSize		= size_t, number of points in each sample;
 //						  zero uses max sample size
 //		overlap			= const double&, percentage overlap (0.0 - 1.0) between
 //						  adjacent samples
@@ -67,201 +72,191 @@ std::unique_ptr<Dataset2D> FastFourierTransform::ComputeFFT(const Dataset2D& dat
 //
 //=============================================================================
 std::unique_ptr<Dataset2D> FastFourierTransform::ComputeFFT(
-	Dataset2D data, const WindowType &window,
+	const Dataset2D& data, const WindowType &window,
 	size_t windowSize, const double &overlap, const bool &subtractMean)
 {
 	const DatasetType sampleRate(static_cast<DatasetType>(1.0) / data.GetAverageDeltaX());// [Hz]
-
-	if (subtractMean)
-		data -= data.ComputeYMean();
+	const DatasetType mean(subtractMean ? data.ComputeYMean() : static_cast<DatasetType>(0.0));
 
 	if (windowSize == 0)
 		windowSize = static_cast<size_t>(
 			pow(2, GetMaxPowerOfTwo(data.GetNumberOfPoints())));
 
-	Dataset2D rawFFT, fft;
+	if (windowSize < 2 || windowSize > data.GetNumberOfPoints())
+		return std::make_unique<Dataset2D>();
+
 	const size_t count(
 		GetNumberOfAverages(windowSize, overlap, data.GetNumberOfPoints()));
-	for (size_t i = 0; i < count; ++i)
+	const size_t hop(windowSize - ComputeOverlapPoints(windowSize, overlap));
+
+	const auto plan(FFTPlan::Get(windowSize, window));
+	FFTPlan::Workspace workspace(*plan);
+
+	auto fft(std::make_unique<Dataset2D>(windowSize / 2 + 1));
+	PopulateFrequencyData(*fft, sampleRate, windowSize);
+	std::fill(fft->GetY().begin(), fft->GetY().end(), static_cast<DatasetType>(0.0));
+
+	// Each sample is transformed where it lies within the data (no copies)
+	const DatasetType scale(static_cast<DatasetType>(1.0) / (windowSize * count));
+	size_t i, j;
+	for (i = 0; i < count; ++i)
 	{
-		rawFFT = ComputeRawFFT(ChopSample(data, i, windowSize, overlap), window);
-		AddToAverage(fft, GetAmplitudeData(rawFFT, sampleRate), count);
+		plan->Execute(data.GetY().data() + i * hop, mean, workspace);
+		for (j = 0; j < fft->GetNumberOfPoints(); ++j)
+			fft->GetY()[j] += sqrt(workspace.real[j] * workspace.real[j]
+				+ workspace.imaginary[j] * workspace.imaginary[j]) * scale;
 	}
-	fft = ConvertDoubleSidedToSingleSided(fft);
-	//ConvertAmplitudeToDecibels(fft);// Appearance can be achieved with log scaled y-axis, so don't force it on them
+	ConvertHalfSpectrumToSingleSided(*fft);
+	//ConvertAmplitudeToDecibels(*fft);// Appearance can be achieved with log scaled y-axis, so don't force it on them
 
-	return std::make_unique<Dataset2D>(fft);
+	return fft;
 }
 
 //=============================================================================
 // Class:			FastFourierTransform
-// Function:		GetMaxPowerOfTwo (static)
+// Function:		ComputePowerSpectralDensity (static)
 //
-// Description:		Returns the max allowable window size given the number of
-//					data points.
+// Description:		Computes the one-sided power spectral density of the
+//					specified samples using Welch's method.  Each segment is
+//					windowed and transformed where it lies within the data,
+//					and the periodograms are summed into a single buffer.  The
+//					result is scaled by 1 / (fs * sum(w^2)) so the density of
+//					white noise is independent of the window and window size.
 //
 // Input Arguments:
-//		sampleSize	= const size_t&
+//		samples			= const DatasetType*
+//		sampleCount		= const size_t&
+//		sampleRate		= const DatasetType& [Hz]
+//		window			= const WindowType&
+//		windowSize		= const size_t&, number of points in each segment
+//		overlap			= const double&, percentage overlap (0.0 - 1.0) between
+//						  adjacent segments
+//		subtractMean	= const bool& indicating that the mean should be
+//						  subtracted from the data
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		size_t
+//		std::vector<DatasetType> containing bins 0 through windowSize / 2
+//		[units^2/Hz]
 //
 //=============================================================================
-size_t FastFourierTransform::GetMaxPowerOfTwo(
-	const size_t &sampleSize)
+std::vector<DatasetType> FastFourierTransform::ComputePowerSpectralDensity(
+	const DatasetType* samples, const size_t &sampleCount,
+	const DatasetType &sampleRate, const WindowType &window,
+	const size_t &windowSize, const double &overlap,
+	const bool &subtractMean)
 {
-	return static_cast<size_t>((log(
-		static_cast<double>(sampleSize)) / log(2.0)));
-}
+	assert(windowSize % 2 == 0);
+	if (windowSize < 2 || windowSize > sampleCount)
+		return std::vector<DatasetType>();
 
-//=============================================================================
-// Class:			FastFourierTransform
-// Function:		ChopSample (static)
-//
-// Description:		Chops the specified sample from the data.
-//
-// Input Arguments:
-//		data		= const Dataset2D&
-//		sample		= const size_t&
-//		windowSize	= const size_t&
-//		overlap		= const double&
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		Dataset2D
-//
-//=============================================================================
-Dataset2D FastFourierTransform::ChopSample(const Dataset2D &data,
-	const size_t &sample, const size_t &windowSize,
-	const double &overlap)
-{
-	assert(overlap >= 0.0 && overlap <= 1.0 && windowSize > 0);
+	DatasetType mean(0.0);
+	if (subtractMean)
+	{
+		double sum(0.0);
+		size_t i;
+		for (i = 0; i < sampleCount; ++i)
+			sum += samples[i];
+		mean = static_cast<DatasetType>(sum / sampleCount);
+	}
 
-	auto overlapSize(static_cast<size_t>(overlap) * windowSize);
-	if (overlapSize >= windowSize)
-		overlapSize = windowSize - 1;
-	const size_t start(sample * (windowSize - overlapSize));
+	const size_t count(GetNumberOfAverages(windowSize, overlap, sampleCount));
+	const size_t hop(windowSize - ComputeOverlapPoints(windowSize, overlap));
+
+	const auto plan(FFTPlan::Get(windowSize, window));
+	FFTPlan::Workspace workspace(*plan);
 
-	assert(start + windowSize <= data.GetNumberOfPoints());
+	// Accumulated in double precision, since there may be many segments
+	const size_t binCount(windowSize / 2 + 1);
+	std::vector<double> power(binCount, 0.0);
 
-	Dataset2D chopped(windowSize);
-	for (size_t i = 0; i < windowSize; ++i)
+	size_t i, j;
+	for (i = 0; i < count; ++i)
 	{
-		chopped.GetX()[i] = data.GetX()[start + i];
-		chopped.GetY()[i] = data.GetY()[start + i];
+		plan->Execute(samples + i * hop, mean, workspace);
+		for (j = 0; j < binCount; ++j)
+			power[j] += workspace.real[j] * workspace.real[j]
+				+ workspace.imaginary[j] * workspace.imaginary[j];
 	}
 
-	return chopped;
-}
+	double windowPower(0.0);
+	for (const auto& w : plan->GetWindowCoefficients())
+		windowPower += static_cast<double>(w) * w;
 
-//=============================================================================
-// Class:			FastFourierTransform
-// Function:		AddToAverage (static)
-//
-// Description:		Adds the data to the average.  Initializes the average
-//					if it is empty.
-//
-// Input Arguments:
-//		average	= Dataset2D& (input and output)
-//		data	= const Dataset2D&
-//		count	= const size_t&
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		None
-//
-//=============================================================================
-void FastFourierTransform::AddToAverage(Dataset2D &average, const Dataset2D &data, const size_t &count)
-{
-	size_t i;
-	if (average.GetNumberOfPoints() == 0)
-	{
-		average.Resize(data.GetNumberOfPoints());
-		for (i = 0; i < average.GetNumberOfPoints(); ++i)
-		{
-			average.GetX()[i] = data.GetX()[i];
-			average.GetY()[i] = 0.0;
-		}
-	}
+	// No factor of 2 for DC or Nyquist points (they have no negative frequency counterpart)
+	const double scale(1.0 / (sampleRate * windowPower * count));
+	std::vector<DatasetType> density(binCount);
+	for (j = 0; j < binCount; ++j)
+		density[j] = static_cast<DatasetType>(power[j] * scale
+			* (j == 0 || j == binCount - 1 ? 1.0 : 2.0));
 
-	for (i = 0; i < average.GetNumberOfPoints(); ++i)
-		average.GetY()[i] += data.GetY()[i] / static_cast<DatasetType>(count);
+	return density;
 }
 
 //=============================================================================
 // Class:			FastFourierTransform
-// Function:		InitializeRawFFTDataset (static)
+// Function:		ComputePowerSpectralDensity (static)
 //
-// Description:		Initializes the raw FFT dataset for future processing.
-//					Applies the specified window.
+// Description:		Computes the one-sided power spectral density of the
+//					specified data using Welch's method.  Assumes y contains
+//					data and x is time.
 //
 // Input Arguments:
-//		data			= const Dataset2D&
-//		numberOfPoints	= const unsigned int&
+//		data			= const Dataset2D& referring to the data of interest
 //		window			= const WindowType&
+//		windowSize		= const size_t&, number of points in each segment
+//		overlap			= const double&, percentage overlap (0.0 - 1.0) between
+//						  adjacent segments
+//		subtractMean	= const bool& indicating that the mean should be
+//						  subtracted from the data
 //
 // Output Arguments:
-//		rawFFT			= Dataset2D&
+//		None
 //
 // Return Value:
-//		None
+//		std::unique_ptr<Dataset2D> containing the density vs. frequency
 //
 //=============================================================================
-void FastFourierTransform::InitializeRawFFTDataset(Dataset2D &rawFFT,
-	const Dataset2D &data, const WindowType &window)
+std::unique_ptr<Dataset2D> FastFourierTransform::ComputePowerSpectralDensity(
+	const Dataset2D& data, const WindowType &window,
+	const size_t &windowSize, const double &overlap,
+	const bool &subtractMean)
 {
-	rawFFT.Resize(data.GetNumberOfPoints());
+	const DatasetType sampleRate(static_cast<DatasetType>(1.0) / data.GetAverageDeltaX());// [Hz]
 
-	unsigned int i;
-	for (i = 0; i < rawFFT.GetNumberOfPoints(); ++i)
-	{
-		rawFFT.GetX()[i] = data.GetY()[i];
-		rawFFT.GetY()[i] = 0.0;
-	}
+	auto psd(std::make_unique<Dataset2D>());
+	psd->GetY() = ComputePowerSpectralDensity(data.GetY().data(), data.GetNumberOfPoints(),
+		sampleRate, window, windowSize, overlap, subtractMean);
+	psd->GetX().resize(psd->GetY().size());
+	PopulateFrequencyData(*psd, sampleRate, windowSize);
 
-	ApplyWindow(rawFFT, window);
+	return psd;
 }
 
 //=============================================================================
 // Class:			FastFourierTransform
-// Function:		ComputeRawFFT (static)
+// Function:		GetMaxPowerOfTwo (static)
 //
-// Description:		Computes the raw (complex) FFT data for the specified
-//					time-domain data.  It is expected that the data has size
-//					equal to the number of points to use for the FFT (it is
-//					one FFT sample).
+// Description:		Returns the max allowable window size given the number of
+//					data points.
 //
 // Input Arguments:
-//		data	= const Dataset2D&
-//		window	= const WindowType& indicating the type of window to use
+//		sampleSize	= const size_t&
 //
 // Output Arguments:
 //		None
 //
 // Return Value:
-//		Dataset2D
+//		size_t
 //
 //=============================================================================
-Dataset2D FastFourierTransform::ComputeRawFFT(const Dataset2D &data,
-	const WindowType &window)
+size_t FastFourierTransform::GetMaxPowerOfTwo(
+	const size_t &sampleSize)
 {
-	Dataset2D rawFFT;
-
-	InitializeRawFFTDataset(rawFFT, data, window);
-	if (data.GetNumberOfPoints() < 2)
-		return rawFFT;
-
-	DoBitReversal(rawFFT);
-	DoFFT(rawFFT);
-
-	return rawFFT;
+	return static_cast<size_t>((log(
+		static_cast<double>(sampleSize)) / log(2.0)));
 }
 
 //=============================================================================
@@ -319,156 +314,28 @@ Dataset2D FastFourierTransform::GenerateConstantDataset(const DatasetType &xValu
 
 //=============================================================================
 // Class:			FastFourierTransform
-// Function:		DoBitReversal (static)
-//
-// Description:		Performs bit reversal on processing dataset.  It is assumed
-//					that the set has already been padded/chopped.
-//
-// Input Arguments:
-//		set			= Dataset2D&
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		None
-//
-//=============================================================================
-void FastFourierTransform::DoBitReversal(Dataset2D &set)
-{
-	assert(double(set.GetNumberOfPoints()) / 2.0 == double(set.GetNumberOfPoints() / 2));
-
-	size_t i, j;
-	DatasetType tempX, tempY;
-
-	j = 0;
-	for (i = 0; i < set.GetNumberOfPoints() - 1; ++i)
-	{
-		if (i < j)
-		{
-			tempX = set.GetX()[i];
-			tempY = set.GetY()[i];
-			set.GetX()[i] = set.GetX()[j];
-			set.GetY()[i] = set.GetY()[j];
-			set.GetX()[j] = tempX;
-			set.GetY()[j] = tempY;
-		}
-
-		size_t k(set.GetNumberOfPoints() >> 1);
-		while (k <= j)
-		{
-			j -= k;
-			k >>= 1;
-		}
-
-		j += k;
-	}
-}
-
-//=============================================================================
-// Class:			FastFourierTransform
-// Function:		DoFFT (static)
+// Function:		ConvertHalfSpectrumToSingleSided (static)
 //
-// Description:		Performs the calculation to get raw FFT data.
+// Description:		Converts the non-negative frequency half of a double-sided
+//					spectrum to a single-sided spectrum by scaling amplitudes
+//					to account for the discarded negative frequency bins.
 //
 // Input Arguments:
-//		powerOfTwo	= const unsigned int&
-//		temp		= Dataset2D&
+//		halfSpectrum	= Dataset2D& containing bins 0 through N/2
 //
 // Output Arguments:
-//		None
+//		halfSpectrum	= Dataset2D& containing single-sided data
 //
 // Return Value:
 //		None
 //
 //=============================================================================
-void FastFourierTransform::DoFFT(Dataset2D &temp)
+void FastFourierTransform::ConvertHalfSpectrumToSingleSided(Dataset2D &halfSpectrum)
 {
-	size_t i, j, i1, l, l2;
-	DatasetType c1, c2, t1, t2, z;
-	auto powerOfTwo = GetMaxPowerOfTwo(temp.GetNumberOfPoints());
-
-	c1 = static_cast<DatasetType>(-1.0);
-	c2 = static_cast<DatasetType>(0.0);
-	l2 = 1;
-	for (l = 0; l < powerOfTwo; ++l)
-	{
-		size_t l1(l2);
-		l2 <<= 1;
-		DatasetType u1(static_cast<DatasetType>(1.0));
-		DatasetType u2(static_cast<DatasetType>(0.0));
-		for (j = 0; j < l1; ++j)
-		{
-			for (i = j; i < temp.GetNumberOfPoints(); i += l2)
-			{
-				i1 = i + l1;
-				t1 = u1 * temp.GetX()[i1] - u2 * temp.GetY()[i1];
-				t2 = u1 * temp.GetY()[i1] + u2 * temp.GetX()[i1];
-				temp.GetX()[i1] = temp.GetX()[i] - t1;
-				temp.GetY()[i1] = temp.GetY()[i] - t2;
-				temp.GetX()[i] += t1;
-				temp.GetY()[i] += t2;
-			}
-			z =  u1 * c1 - u2 * c2;
-			u2 = u1 * c2 + u2 * c1;
-			u1 = z;
-		}
-		c2 = sqrt((static_cast<DatasetType>(1.0) - c1) / static_cast<DatasetType>(2.0));
-		c2 = -c2;
-		c1 = sqrt((static_cast<DatasetType>(1.0) + c1) / static_cast<DatasetType>(2.0));
-	}
-}
-
-//=============================================================================
-// Class:			FastFourierTransform
-// Function:		ConvertDoubleSidedToSingleSided (static)
-//
-// Description:		Converts double-sided data to single-sided.  Discards
-//					negative frequency portion of data and scales amplitudes
-//					as necessary.
-//
-// Input Arguments:
-//		fullSpectrum	= const Dataset2D& containing double-sided data
-//		preserveDCValue	= const bool& indicating whether or not to keep the 0 Hz point (optional)
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		Dataset2D containing single-sided data
-//
-//=============================================================================
-Dataset2D FastFourierTransform::ConvertDoubleSidedToSingleSided(
-	const Dataset2D &fullSpectrum, const bool &preserveDCValue)
-{
-	Dataset2D halfSpectrum;
+	// No factor of 2 for DC point
 	unsigned int i;
-
-	if (preserveDCValue)
-	{
-		halfSpectrum.Resize(fullSpectrum.GetNumberOfPoints() / 2 + 1);
-
-		halfSpectrum.GetX()[0] = fullSpectrum.GetX()[0];
-		halfSpectrum.GetY()[0] = fullSpectrum.GetY()[0];// No factor of 2 for DC point
-
-		for (i = 1; i < halfSpectrum.GetNumberOfPoints(); ++i)
-		{
-			halfSpectrum.GetX()[i] = fullSpectrum.GetX()[i];
-			halfSpectrum.GetY()[i] = fullSpectrum.GetY()[i] * static_cast<DatasetType>(2.0);
-		}
-	}
-	else
-	{
-		halfSpectrum.Resize(fullSpectrum.GetNumberOfPoints() / 2);
-
-		for (i = 0; i < halfSpectrum.GetNumberOfPoints(); ++i)
-		{
-			halfSpectrum.GetX()[i] = fullSpectrum.GetX()[i + 1];
-			halfSpectrum.GetY()[i] = fullSpectrum.GetY()[i + 1];
-		}
-	}
-
-	return halfSpectrum;
+	for (i = 1; i < halfSpectrum.GetNumberOfPoints(); ++i)
+		halfSpectrum.GetY()[i] *= static_cast<DatasetType>(2.0);
 }
 
 //=============================================================================
@@ -506,6 +373,7 @@ void FastFourierTransform::ConvertAmplitudeToDecibels(Dataset2D &fft)
 //
 // Input Arguments:
 //		sampleRate	= const DatasetType& [Hz]
+//		fftSize		= const size_t& number of points in the transform
 //
 // Output Arguments:
 //		data		= Dataset2D&
@@ -515,43 +383,11 @@ void FastFourierTransform::ConvertAmplitudeToDecibels(Dataset2D &fft)
 //
 //=============================================================================
 void FastFourierTransform::PopulateFrequencyData(Dataset2D &data,
-	const DatasetType &sampleRate)
+	const DatasetType &sampleRate, const size_t &fftSize)
 {
 	unsigned int i;
 	for (i = 0; i < data.GetNumberOfPoints(); ++i)
-		data.GetX()[i] = i * sampleRate / data.GetNumberOfPoints();
-}
-
-//=============================================================================
-// Class:			FastFourierTransform
-// Function:		GetAmplitudeData (static)
-//
-// Description:		Calculates the amplitude data from raw FFT data (containing
-//					real and imaginary data components).
-//
-// Input Arguments:
-//		rawFFT		= const Dataset2D&
-//		sampleRate	= const DatasetType& [Hz]
-//
-// Output Arguments:
-//		None
-//
-// Return Value:
-//		Dataset2D
-//
-//=============================================================================
-Dataset2D FastFourierTransform::GetAmplitudeData(const Dataset2D &rawFFT,
-	const DatasetType &sampleRate)
-{
-	Dataset2D data(rawFFT);
-	PopulateFrequencyData(data, sampleRate);
-
-	unsigned int i;
-	for (i = 0; i < data.GetNumberOfPoints(); ++i)
-		data.GetY()[i] = sqrt(rawFFT.GetX()[i] * rawFFT.GetX()[i]
-		+ rawFFT.GetY()[i] * rawFFT.GetY()[i]) / rawFFT.GetNumberOfPoints();
-
-	return data;
+		data.GetX()[i] = i * sampleRate / fftSize;
 }
 
 //=============================================================================
@@ -761,6 +597,168 @@ void FastFourierTransform::ApplyWindow(Dataset2D &data, const WindowType &window
 		assert(false);
 }
 
+//=============================================================================
+// Class:			FastFourierTransform
+// Function:		ComputeWindowCoefficients (static)
+//
+// Description:		Returns the coefficients of the specified window type.
+//					Multiplying data by these coefficients is equivalent to
+//					calling ApplyWindow().
+//
+// Input Arguments:
+//		window	= const WindowType&
+//		size	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<DatasetType>
+//
+//=============================================================================
+std::vector<DatasetType> FastFourierTransform::ComputeWindowCoefficients(
+	const WindowType &window, const size_t &size)
+{
+	Dataset2D coefficients(GenerateConstantDataset(1.0, 0.0, size));
+	ApplyWindow(coefficients, window);
+	return coefficients.GetX();
+}
+
+//=============================================================================
+// Class:			FastFourierTransform
+// Function:		ComputeDoubleWindowCoefficients (static)
+//
+// Description:		Returns the coefficients of the specified window type,
+//					evaluated in double precision.  Cosine-sum windows are
+//					evaluated from GetCosineSumTerms(), which matches the
+//					Apply*Window() methods.
+//
+// Input Arguments:
+//		window	= const WindowType&
+//		size	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<double>
+//
+//=============================================================================
+std::vector<double> FastFourierTransform::ComputeDoubleWindowCoefficients(
+	const WindowType &window, const size_t &size)
+{
+	std::vector<double> coefficients(size, 1.0);
+	const double pointsMinusOne(size - 1.0);
+	size_t i, j;
+	std::vector<double> terms;
+	if (GetCosineSumTerms(window, terms))
+	{
+		for (i = 0; i < size; ++i)
+		{
+			coefficients[i] = terms.front();
+			for (j = 1; j < terms.size(); ++j)
+				coefficients[i] += terms[j] * cos(2.0 * M_PI * j * i / pointsMinusOne);
+		}
+	}
+	else
+	{
+		assert(window == WindowType::Exponential);
+		const double tau(-pointsMinusOne / log(0.02));
+		for (i = 0; i < size; ++i)
+			coefficients[i] = exp(-static_cast<double>(i) / tau);
+	}
+
+	return coefficients;
+}
+
+//=============================================================================
+// Class:			FastFourierTransform
+// Function:		GetWindowCoefficients (static)
+//
+// Description:		Returns cached coefficients of the specified window type,
+//					computing them if necessary.  The most recently used
+//					tables are retained, so FFT plans, chirp-z transforms,
+//					etc. with the same window share one table instead of each
+//					evaluating the window function.
+//
+// Input Arguments:
+//		window	= const WindowType&
+//		size	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::shared_ptr<const std::vector<DatasetType>>
+//
+//=============================================================================
+std::shared_ptr<const std::vector<DatasetType>> FastFourierTransform::GetWindowCoefficients(
+	const WindowType &window, const size_t &size)
+{
+	typedef std::pair<WindowType, size_t> Key;
+	typedef std::pair<Key, std::shared_ptr<const std::vector<DatasetType>>> Entry;
+	const size_t maxCachedTables(16);
+
+	static std::mutex cacheMutex;
+	static std::list<Entry> cache;// Most recently used at front
+
+	const Key key(window, size);
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	for (auto it = cache.begin(); it != cache.end(); ++it)
+	{
+		if (it->first == key)
+		{
+			cache.splice(cache.begin(), cache, it);
+			return cache.front().second;
+		}
+	}
+
+	cache.emplace_front(key, std::make_shared<const std::vector<DatasetType>>(
+		ComputeWindowCoefficients(window, size)));
+	if (cache.size() > maxCachedTables)
+		cache.pop_back();
+
+	return cache.front().second;
+}
+
+//=============================================================================
+// Class:			FastFourierTransform
+// Function:		GetCosineSumTerms (static)
+//
+// Description:		Returns the terms of the specified window if it is a sum
+//					of cosines with period N - 1.  Must be kept consistent
+//					with the Apply*Window() methods.
+//
+// Input Arguments:
+//		window	= const WindowType&
+//
+// Output Arguments:
+//		terms	= std::vector<double>&
+//
+// Return Value:
+//		bool, true if the window is a sum of cosines
+//
+//=============================================================================
+bool FastFourierTransform::GetCosineSumTerms(const WindowType &window,
+	std::vector<double> &terms)
+{
+	if (window == WindowType::Uniform)
+		terms = { 1.0 };
+	else if (window == WindowType::Hann)
+		terms = { 1.0, -1.0 };
+	else if (window == WindowType::Hamming)
+		terms = { 1.0, -0.46 / 0.54 };
+	else if (window == WindowType::FlatTop)
+		terms = { 1.0, -1.93, 1.29, -0.388, 0.032 };
+	else
+	{
+		terms.clear();
+		return false;
+	}
+
+	return true;
+}
+
 //=============================================================================
 // Class:			FastFourierTransform
 // Function:		ApplyHannWindow (static)
@@ -947,12 +945,43 @@ size_t FastFourierTransform::GetNumberOfAverages(
 	const size_t windowSize, const double &overlap,
 	const size_t &dataSize)
 {
-	auto overlapSize(static_cast<size_t>(overlap) * windowSize);
-	if (overlapSize >= windowSize)
-		overlapSize = windowSize - 1;
+	if (windowSize == 0 || dataSize < windowSize)
+		return 0;
+
+	const size_t overlapSize(ComputeOverlapPoints(windowSize, overlap));
 	return (dataSize - overlapSize) / (windowSize - overlapSize);
 }
 
+//=============================================================================
+// Class:			FastFourierTransform
+// Function:		ComputeOverlapPoints (static)
+//
+// Description:		Returns the number of points shared by adjacent windows.
+//					At least one point is never shared, so consecutive windows
+//					always advance.
+//
+// Input Arguments:
+//		windowSize	= const size_t&
+//		overlap		= const double&, percentage overlap (0.0 - 1.0)
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		size_t
+//
+//=============================================================================
+size_t FastFourierTransform::ComputeOverlapPoints(const size_t &windowSize,
+	const double &overlap)
+{
+	assert(overlap >= 0.0 && overlap <= 1.0 && windowSize > 0);
+
+	const auto overlapSize(static_cast<size_t>(std::round(overlap * windowSize)));
+	if (overlapSize >= windowSize)
+		return windowSize - 1;
+	return overlapSize;
+}
+
 //=============================================================================
 // Class:			FastFourierTransform
 // Function:		ComputeOverlap (static)
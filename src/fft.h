@@ -67,10 +67,51 @@ public:
 	/// \return The processed amplitude vs. frequency FFT information.
 	///
 	/// \see GetNumberOfAverages
-	static std::unique_ptr<Dataset2D> ComputeFFT(Dataset2D data,
+	static std::unique_ptr<Dataset2D> ComputeFFT(const Dataset2D& data,
 		const WindowType &window, size_t windowSize,
 		const double &overlap, const bool &subtractMean);
 
+	/// Computes the one-sided power spectral density of the specified samples
+	/// using Welch's method (the average of the windowed periodograms of
+	/// overlapping segments).  Segments are read in place and accumulated
+	/// in a single buffer, so no copies of the data are made.
+	///
+	/// \param samples      Pointer to the first sample.
+	/// \param sampleCount  Number of samples.
+	/// \param sampleRate   Sample rate of the data [Hz].
+	/// \param window       Window function to be applied to each segment.
+	/// \param windowSize   Length of each segment (must be even).
+	/// \param overlap      Overlap between adjacent segments in percent (0.0
+	///                     to 1.0).
+	/// \param subtractMean Indicates whether or not the data should be
+	///                     mean-subtracted to remove DC content.
+	///
+	/// \return Density in bins 0 through windowSize / 2 [units^2/Hz], spaced
+	///         by sampleRate / windowSize.  Empty if there are fewer samples
+	///         than windowSize.
+	static std::vector<DatasetType> ComputePowerSpectralDensity(
+		const DatasetType* samples, const size_t &sampleCount,
+		const DatasetType &sampleRate, const WindowType &window,
+		const size_t &windowSize, const double &overlap,
+		const bool &subtractMean);
+
+	/// Computes the one-sided power spectral density of the specified
+	/// dataset using Welch's method.  Assumes y contains data and x is time.
+	///
+	/// \param data         Data for which the density should be computed.
+	/// \param window       Window function to be applied to each segment.
+	/// \param windowSize   Length of each segment (must be even).
+	/// \param overlap      Overlap between adjacent segments in percent (0.0
+	///                     to 1.0).
+	/// \param subtractMean Indicates whether or not the data should be
+	///                     mean-subtracted to remove DC content.
+	///
+	/// \return The power spectral density vs. frequency.
+	static std::unique_ptr<Dataset2D> ComputePowerSpectralDensity(
+		const Dataset2D& data, const WindowType &window,
+		const size_t &windowSize, const double &overlap,
+		const bool &subtractMean);
+
 	/// Returns the number of averages to be used given the specified window
 	/// parameters.
 	///
@@ -110,6 +151,51 @@ public:
 	///         size.
 	static size_t GetMaxPowerOfTwo(const size_t &sampleSize);
 
+	/// Returns the coefficients of the specified window.  Multiplying data
+	/// by these coefficients is equivalent to applying the window.
+	///
+	/// \param window Type of window.
+	/// \param size   Number of points in the window.
+	///
+	/// \return The window coefficients.
+	static std::vector<DatasetType> ComputeWindowCoefficients(
+		const WindowType &window, const size_t &size);
+
+	/// Returns the coefficients of the specified window, evaluated in double
+	/// precision.  The values are the same as ComputeWindowCoefficients()
+	/// returns, before rounding to single precision.
+	///
+	/// \param window Type of window.
+	/// \param size   Number of points in the window.
+	///
+	/// \return The window coefficients.
+	static std::vector<double> ComputeDoubleWindowCoefficients(
+		const WindowType &window, const size_t &size);
+
+	/// Returns the coefficients of the specified window from a cache shared
+	/// by all callers.  Coefficients are computed only if a matching table is
+	/// not already cached.
+	///
+	/// \param window Type of window.
+	/// \param size   Number of points in the window.
+	///
+	/// \return The shared window coefficients.
+	static std::shared_ptr<const std::vector<DatasetType>> GetWindowCoefficients(
+		const WindowType &window, const size_t &size);
+
+	/// Returns the terms of the specified window if it is a sum of cosines,
+	/// i.e. the coefficient of point i of an N point window is the sum over
+	/// l of terms[l] * cos(2 * pi * l * i / (N - 1)).  Such windows can be
+	/// applied in the frequency domain.
+	///
+	/// \param window Type of window.
+	/// \param terms  Coefficient of each cosine term (the first is the
+	///               constant term).
+	///
+	/// \return True if the window is a sum of cosines, false otherwise.
+	static bool GetCosineSumTerms(const WindowType &window,
+		std::vector<double> &terms);
+
 private:
 	static void ApplyWindow(Dataset2D &data, const WindowType &window);
 	static void ApplyHannWindow(Dataset2D &data);
@@ -118,27 +204,17 @@ private:
 	//static void ApplyForceWindow(Dataset2D &data);
 	static void ApplyExponentialWindow(Dataset2D &data);
 
-	static void DoBitReversal(Dataset2D &set);
-	static void DoFFT(Dataset2D &temp);
-
 	static void ZeroDataset(Dataset2D &data);
 	static Dataset2D GenerateConstantDataset(const DatasetType &xValue, const DatasetType &yValue, const size_t &size);
 
-	static Dataset2D ConvertDoubleSidedToSingleSided(const Dataset2D &fullSpectrum, const bool &preserveDCValue = true);
+	static void ConvertHalfSpectrumToSingleSided(Dataset2D &halfSpectrum);
 
-	static Dataset2D ChopSample(const Dataset2D &data, const size_t &sample,
-		const size_t &windowSize, const double &overlap);
-
-	static void AddToAverage(Dataset2D &average, const Dataset2D &data, const size_t &count);
+	static size_t ComputeOverlapPoints(const size_t &windowSize,
+		const double &overlap);
 
 	static void ConvertAmplitudeToDecibels(Dataset2D &fft);
 
-	static void PopulateFrequencyData(Dataset2D &data, const DatasetType &sampleRate);
-
-	static Dataset2D GetAmplitudeData(const Dataset2D &rawFFT, const DatasetType &sampleRate);
-
-	static Dataset2D ComputeRawFFT(const Dataset2D &data, const WindowType &window);
-	static void InitializeRawFFTDataset(Dataset2D &rawFFT, const Dataset2D &data, const WindowType &window);
+	static void PopulateFrequencyData(Dataset2D &data, const DatasetType &sampleRate, const size_t &fftSize);
 
 	static Dataset2D ComplexAdd(const Dataset2D &a, const Dataset2D &b);
 	static Dataset2D ComplexMultiply(const Dataset2D &a, const Dataset2D &b);
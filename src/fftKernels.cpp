@@ -0,0 +1,854 @@
+// File:  fftKernels.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Vectorized butterfly kernels for FFTPlan, selected at runtime.
+
+// Local headers
+#include "fftKernels.h"
+
+// Standard C++ headers
+#include <cmath>
+#include <cassert>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define FFT_KERNELS_X86
+
+// Standard C++ headers
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+// MSVC permits use of any intrinsic without special compiler options
+#define FFT_TARGET_SSE2
+#define FFT_TARGET_AVX2
+#define FFT_TARGET_AVX512
+#else
+// GCC and clang require the target to be specified for each function that
+// uses instructions beyond those enabled on the command line
+#define FFT_TARGET_SSE2 __attribute__((target("sse2")))
+#define FFT_TARGET_AVX2 __attribute__((target("avx2")))
+#define FFT_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+#endif// x86
+
+//=============================================================================
+// Class:			FFTKernels
+// Function:		GetSupportedInstructionSet (static)
+//
+// Description:		Returns the most capable instruction set supported by the
+//					CPU.  Detection is performed on the first call only.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		InstructionSet
+//
+//=============================================================================
+FFTKernels::InstructionSet FFTKernels::GetSupportedInstructionSet()
+{
+	static const InstructionSet set(DetectInstructionSet());
+	return set;
+}
+
+//=============================================================================
+// Class:			FFTKernels
+// Function:		DetectInstructionSet (static)
+//
+// Description:		Queries the CPU (and for the wider registers, the OS) for
+//					support of each instruction set for which we have a
+//					kernel.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		InstructionSet
+//
+//=============================================================================
+FFTKernels::InstructionSet FFTKernels::DetectInstructionSet()
+{
+#ifdef FFT_KERNELS_X86
+#ifdef _MSC_VER
+	int info[4];
+	__cpuid(info, 0);
+	const int maxFunction(info[0]);
+
+	__cpuid(info, 1);
+	const bool hasSSE2((info[3] & (1 << 26)) != 0);
+	const bool hasOSXSave((info[2] & (1 << 27)) != 0);
+	const bool hasAVX((info[2] & (1 << 28)) != 0);
+
+	bool hasAVX2(false), hasAVX512(false);
+	if (hasOSXSave && hasAVX && maxFunction >= 7)
+	{
+		// Check that the OS saves the YMM (and ZMM) register state
+		const unsigned long long xcr0(_xgetbv(0));
+		__cpuidex(info, 7, 0);
+		hasAVX2 = (xcr0 & 0x06) == 0x06 && (info[1] & (1 << 5)) != 0;
+		hasAVX512 = (xcr0 & 0xe6) == 0xe6 && (info[1] & (1 << 16)) != 0;
+	}
+
+	if (hasAVX512)
+		return InstructionSet::AVX512;
+	else if (hasAVX2)
+		return InstructionSet::AVX2;
+	else if (hasSSE2)
+		return InstructionSet::SSE2;
+#else
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f"))
+		return InstructionSet::AVX512;
+	else if (__builtin_cpu_supports("avx2"))
+		return InstructionSet::AVX2;
+	else if (__builtin_cpu_supports("sse2"))
+		return InstructionSet::SSE2;
+#endif
+#endif// FFT_KERNELS_X86
+
+	return InstructionSet::Scalar;
+}
+
+//=============================================================================
+// Class:			FFTKernels
+// Function:		GetRadixFourPass (static)
+//
+// Description:		Returns the fused two-stage kernel for the specified
+//					instruction set.
+//
+// Input Arguments:
+//		set	= const InstructionSet&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		RadixFourPass
+//
+//=============================================================================
+template <>
+FFTKernels::RadixFourPass<float> FFTKernels::GetRadixFourPass<float>(const InstructionSet& set)
+{
+	switch (set)
+	{
+	case InstructionSet::AVX512:
+		return AVX512RadixFourPass;
+
+	case InstructionSet::AVX2:
+		return AVX2RadixFourPass;
+
+	case InstructionSet::SSE2:
+		return SSE2RadixFourPass;
+
+	default:
+	case InstructionSet::Scalar:
+		return ScalarRadixFourPass<float>;
+	}
+}
+
+// Vectorized kernels operate on floats only, so double precision always uses
+// the portable implementation
+template <>
+FFTKernels::RadixFourPass<double> FFTKernels::GetRadixFourPass<double>(const InstructionSet&)
+{
+	return ScalarRadixFourPass<double>;
+}
+
+//=============================================================================
+// Class:			FFTKernels
+// Function:		GetWindowPack (static)
+//
+// Description:		Returns the windowing and packing kernel for the
+//					specified instruction set.
+//
+// Input Arguments:
+//		set	= const InstructionSet&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		WindowPack
+//
+//=============================================================================
+template <>
+FFTKernels::WindowPack<float> FFTKernels::GetWindowPack<float>(const InstructionSet& set)
+{
+	switch (set)
+	{
+	case InstructionSet::AVX512:
+		return AVX512WindowPack;
+
+	case InstructionSet::AVX2:
+		return AVX2WindowPack;
+
+	case InstructionSet::SSE2:
+		return SSE2WindowPack;
+
+	default:
+	case InstructionSet::Scalar:
+		return ScalarWindowPack<float>;
+	}
+}
+
+// Vectorized kernels operate on floats only, so double precision always uses
+// the portable implementation
+template <>
+FFTKernels::WindowPack<double> FFTKernels::GetWindowPack<double>(const InstructionSet&)
+{
+	return ScalarWindowPack<double>;
+}
+
+//=============================================================================
+// Class:			FFTKernels
+// Function:		GetName (static)
+//
+// Description:		Returns a string describing the specified instruction set.
+//
+// Input Arguments:
+//		set	= const InstructionSet&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::string
+//
+//=============================================================================
+std::string FFTKernels::GetName(const InstructionSet& set)
+{
+	switch (set)
+	{
+	case InstructionSet::AVX512:
+		return "AVX-512";
+
+	case InstructionSet::AVX2:
+		return "AVX2";
+
+	case InstructionSet::SSE2:
+		return "SSE2";
+
+	default:
+	case InstructionSet::Scalar:
+		return "Scalar";
+	}
+}
+
+//=============================================================================
+// Class:			FFTKernels
+// Function:		RadixTwoFirstPass (static)
+//
+// Description:		Performs the first radix-2 stage (span of one), for which
+//					all twiddle factors are unity.
+//
+// Input Arguments:
+//		real		= T*
+//		imaginary	= T*
+//		size		= const size_t&
+//
+// Output Arguments:
+//		real		= T*
+//		imaginary	= T*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void FFTKernels::RadixTwoFirstPass(T* real, T* imaginary,
+	const size_t& size)
+{
+	size_t i;
+	for (i = 0; i + 1 < size; i += 2)
+	{
+		const T tReal(real[i + 1]);
+		const T tImaginary(imaginary[i + 1]);
+		real[i + 1] = real[i] - tReal;
+		imaginary[i + 1] = imaginary[i] - tImaginary;
+		real[i] += tReal;
+		imaginary[i] += tImaginary;
+	}
+}
+
+const unsigned int FFTKernels::maxMixedRadix(7);
+
+//=============================================================================
+// Class:			FFTKernels
+// Function:		MixedRadixPass (static)
+//
+// Description:		Performs one decimation-in-time stage of radix p.  Each
+//					butterfly combines points a0..a(p-1) separated by span
+//					(the j-th points of p sub-transforms), multiplying each by
+//					its twiddle factor and then computing the p-point DFT
+//					y[k] = sum(a[q] * exp(-2 * pi * i * q * k / p)).  Radices 2
+//					and 4 are written out; odd radices pair a[q] with
+//					a[p - q], so each output needs (p - 1) / 2 complex
+//					multiplications by real constants.
+//
+// Input Arguments:
+//		real				= T*
+//		imaginary			= T*
+//		size				= const size_t&
+//		span				= const size_t&
+//		radix				= const unsigned int&
+//		twiddleReal			= const T*
+//		twiddleImaginary	= const T*
+//
+// Output Arguments:
+//		real				= T*
+//		imaginary			= T*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void FFTKernels::MixedRadixPass(T* real, T* imaginary,
+	const size_t& size, const size_t& span, const unsigned int& radix,
+	const T* twiddleReal, const T* twiddleImaginary)
+{
+	assert(radix >= 2 && radix <= maxMixedRadix);
+	assert(size % (radix * span) == 0);
+
+	// Constants for the odd radix DFT
+	T cosine[maxMixedRadix], sine[maxMixedRadix];
+	unsigned int q, k;
+	for (q = 0; q < radix; ++q)
+	{
+		cosine[q] = static_cast<T>(cos(2.0 * M_PI * q / radix));
+		sine[q] = static_cast<T>(sin(2.0 * M_PI * q / radix));
+	}
+
+	T aReal[maxMixedRadix], aImaginary[maxMixedRadix];
+	const size_t groupSize(radix * span);
+	size_t group, j;
+	for (group = 0; group < size; group += groupSize)
+	{
+		for (j = 0; j < span; ++j)
+		{
+			T* r(real + group + j);
+			T* im(imaginary + group + j);
+
+			aReal[0] = r[0];
+			aImaginary[0] = im[0];
+			for (q = 1; q < radix; ++q)
+			{
+				const T wReal(twiddleReal[(q - 1) * span + j]);
+				const T wImaginary(twiddleImaginary[(q - 1) * span + j]);
+				aReal[q] = r[q * span] * wReal - im[q * span] * wImaginary;
+				aImaginary[q] = r[q * span] * wImaginary + im[q * span] * wReal;
+			}
+
+			if (radix == 2)
+			{
+				r[0] = aReal[0] + aReal[1];
+				im[0] = aImaginary[0] + aImaginary[1];
+				r[span] = aReal[0] - aReal[1];
+				im[span] = aImaginary[0] - aImaginary[1];
+			}
+			else if (radix == 4)
+			{
+				const T sum02Real(aReal[0] + aReal[2]);
+				const T sum02Imaginary(aImaginary[0] + aImaginary[2]);
+				const T difference02Real(aReal[0] - aReal[2]);
+				const T difference02Imaginary(aImaginary[0] - aImaginary[2]);
+				const T sum13Real(aReal[1] + aReal[3]);
+				const T sum13Imaginary(aImaginary[1] + aImaginary[3]);
+				const T difference13Real(aReal[1] - aReal[3]);
+				const T difference13Imaginary(aImaginary[1] - aImaginary[3]);
+
+				r[0] = sum02Real + sum13Real;
+				im[0] = sum02Imaginary + sum13Imaginary;
+				r[2 * span] = sum02Real - sum13Real;
+				im[2 * span] = sum02Imaginary - sum13Imaginary;
+
+				// y1 = d02 - i * d13 and y3 = d02 + i * d13
+				r[span] = difference02Real + difference13Imaginary;
+				im[span] = difference02Imaginary - difference13Real;
+				r[3 * span] = difference02Real - difference13Imaginary;
+				im[3 * span] = difference02Imaginary + difference13Real;
+			}
+			else
+			{
+				assert(radix % 2 == 1);
+				const unsigned int pairCount(radix / 2);
+				T sumReal[maxMixedRadix / 2], sumImaginary[maxMixedRadix / 2];
+				T differenceReal[maxMixedRadix / 2], differenceImaginary[maxMixedRadix / 2];
+				T dcReal(aReal[0]), dcImaginary(aImaginary[0]);
+				for (q = 1; q <= pairCount; ++q)
+				{
+					sumReal[q - 1] = aReal[q] + aReal[radix - q];
+					sumImaginary[q - 1] = aImaginary[q] + aImaginary[radix - q];
+					differenceReal[q - 1] = aReal[q] - aReal[radix - q];
+					differenceImaginary[q - 1] = aImaginary[q] - aImaginary[radix - q];
+					dcReal += sumReal[q - 1];
+					dcImaginary += sumImaginary[q - 1];
+				}
+
+				r[0] = dcReal;
+				im[0] = dcImaginary;
+				for (k = 1; k <= pairCount; ++k)
+				{
+					// Real-weighted sums (c) and sine-weighted differences (s);
+					// y[k] = c - i * s and y[p - k] = c + i * s
+					T cReal(aReal[0]), cImaginary(aImaginary[0]);
+					T sReal(0.0), sImaginary(0.0);
+					for (q = 1; q <= pairCount; ++q)
+					{
+						const unsigned int index((q * k) % radix);
+						cReal += cosine[index] * sumReal[q - 1];
+						cImaginary += cosine[index] * sumImaginary[q - 1];
+						sReal += sine[index] * differenceReal[q - 1];
+						sImaginary += sine[index] * differenceImaginary[q - 1];
+					}
+
+					r[k * span] = cReal + sImaginary;
+					im[k * span] = cImaginary - sReal;
+					r[(radix - k) * span] = cReal - sImaginary;
+					im[(radix - k) * span] = cImaginary + sReal;
+				}
+			}
+		}
+	}
+}
+
+//=============================================================================
+// Class:			FFTKernels
+// Function:		ScalarRadixFourPass (static)
+//
+// Description:		Performs two radix-2 stages (spans s and 2s) in one pass.
+//					For each group of four points a0..a3 separated by s, with
+//					w1 the stage s twiddle and w2 the stage 2s twiddle, the
+//					first stage produces b0,1 = a0 +/- w1 * a1 and
+//					b2,3 = a2 +/- w1 * a3, and the second produces
+//					c0,2 = b0 +/- w2 * b2 and c1,3 = b1 +/- (-i) * w2 * b3
+//					(the stage 2s twiddle for index j + s is -i times that
+//					for index j).
+//
+// Input Arguments:
+//		real				= T*
+//		imaginary			= T*
+//		size				= const size_t&
+//		span				= const size_t&
+//		twiddleReal			= const T*
+//		twiddleImaginary	= const T*
+//
+// Output Arguments:
+//		real				= T*
+//		imaginary			= T*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void FFTKernels::ScalarRadixFourPass(T* real, T* imaginary,
+	const size_t& size, const size_t& span, const T* twiddleReal,
+	const T* twiddleImaginary)
+{
+	const T* w1Real(twiddleReal + span - 1);
+	const T* w1Imaginary(twiddleImaginary + span - 1);
+	const T* w2Real(twiddleReal + 2 * span - 1);
+	const T* w2Imaginary(twiddleImaginary + 2 * span - 1);
+
+	size_t i, j;
+	for (i = 0; i < size; i += 4 * span)
+	{
+		T* r0(real + i);
+		T* r1(r0 + span);
+		T* r2(r1 + span);
+		T* r3(r2 + span);
+		T* i0(imaginary + i);
+		T* i1(i0 + span);
+		T* i2(i1 + span);
+		T* i3(i2 + span);
+
+		for (j = 0; j < span; ++j)
+		{
+			const T t1Real(w1Real[j] * r1[j] - w1Imaginary[j] * i1[j]);
+			const T t1Imaginary(w1Real[j] * i1[j] + w1Imaginary[j] * r1[j]);
+			const T t3Real(w1Real[j] * r3[j] - w1Imaginary[j] * i3[j]);
+			const T t3Imaginary(w1Real[j] * i3[j] + w1Imaginary[j] * r3[j]);
+
+			const T b0Real(r0[j] + t1Real), b0Imaginary(i0[j] + t1Imaginary);
+			const T b1Real(r0[j] - t1Real), b1Imaginary(i0[j] - t1Imaginary);
+			const T b2Real(r2[j] + t3Real), b2Imaginary(i2[j] + t3Imaginary);
+			const T b3Real(r2[j] - t3Real), b3Imaginary(i2[j] - t3Imaginary);
+
+			const T u2Real(w2Real[j] * b2Real - w2Imaginary[j] * b2Imaginary);
+			const T u2Imaginary(w2Real[j] * b2Imaginary + w2Imaginary[j] * b2Real);
+			// -i * (w2 * b3)
+			const T u3Real(w2Real[j] * b3Imaginary + w2Imaginary[j] * b3Real);
+			const T u3Imaginary(-(w2Real[j] * b3Real - w2Imaginary[j] * b3Imaginary));
+
+			r0[j] = b0Real + u2Real;
+			i0[j] = b0Imaginary + u2Imaginary;
+			r2[j] = b0Real - u2Real;
+			i2[j] = b0Imaginary - u2Imaginary;
+			r1[j] = b1Real + u3Real;
+			i1[j] = b1Imaginary + u3Imaginary;
+			r3[j] = b1Real - u3Real;
+			i3[j] = b1Imaginary - u3Imaginary;
+		}
+	}
+}
+
+// The vectorized kernels below are identical apart from the register type
+// and width; each processes that many adjacent butterflies (consecutive j)
+// per iteration.  The twiddle tables for each stage are contiguous, so all
+// loads are unit-stride.
+
+//=============================================================================
+// Class:			FFTKernels
+// Function:		ScalarWindowPack (static)
+//
+// Description:		Removes the offset from each sample, applies the window
+//					and separates the even and odd samples.  The vectorized
+//					versions use this for any points remaining after the last
+//					full vector.
+//
+// Input Arguments:
+//		input	= const T*
+//		offset	= const T&
+//		window	= const T*
+//		count	= const size_t&
+//
+// Output Arguments:
+//		even	= T*
+//		odd		= T*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void FFTKernels::ScalarWindowPack(const T* input, const T& offset,
+	const T* window, const size_t& count, T* even, T* odd)
+{
+	size_t i;
+	for (i = 0; i < count; ++i)
+	{
+		even[i] = (input[2 * i] - offset) * window[2 * i];
+		odd[i] = (input[2 * i + 1] - offset) * window[2 * i + 1];
+	}
+}
+
+#ifdef FFT_KERNELS_X86
+
+FFT_TARGET_SSE2
+void FFTKernels::SSE2WindowPack(const float* input, const float& offset,
+	const float* window, const size_t& count, float* even, float* odd)
+{
+	const size_t width(4);
+	const __m128 o(_mm_set1_ps(offset));
+
+	size_t i;
+	for (i = 0; i + width <= count; i += width)
+	{
+		const __m128 a(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(input + 2 * i), o), _mm_loadu_ps(window + 2 * i)));
+		const __m128 b(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(input + 2 * i + width), o), _mm_loadu_ps(window + 2 * i + width)));
+		_mm_storeu_ps(even + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+		_mm_storeu_ps(odd + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+	}
+
+	ScalarWindowPack(input + 2 * i, offset, window + 2 * i, count - i, even + i, odd + i);
+}
+
+FFT_TARGET_AVX2
+void FFTKernels::AVX2WindowPack(const float* input, const float& offset,
+	const float* window, const size_t& count, float* even, float* odd)
+{
+	const size_t width(8);
+	const __m256 o(_mm256_set1_ps(offset));
+
+	size_t i;
+	for (i = 0; i + width <= count; i += width)
+	{
+		const __m256 a(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(input + 2 * i), o), _mm256_loadu_ps(window + 2 * i)));
+		const __m256 b(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(input + 2 * i + width), o), _mm256_loadu_ps(window + 2 * i + width)));
+
+		// Shuffles operate within 128-bit lanes, so the 64-bit halves must be reordered afterwards
+		const __m256 evenLanes(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+		const __m256 oddLanes(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+		_mm256_storeu_ps(even + i, _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(evenLanes), _MM_SHUFFLE(3, 1, 2, 0))));
+		_mm256_storeu_ps(odd + i, _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(oddLanes), _MM_SHUFFLE(3, 1, 2, 0))));
+	}
+
+	ScalarWindowPack(input + 2 * i, offset, window + 2 * i, count - i, even + i, odd + i);
+}
+
+FFT_TARGET_AVX512
+void FFTKernels::AVX512WindowPack(const float* input, const float& offset,
+	const float* window, const size_t& count, float* even, float* odd)
+{
+	const size_t width(16);
+	const __m512 o(_mm512_set1_ps(offset));
+	const __m512i evenIndices(_mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30));
+	const __m512i oddIndices(_mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31));
+
+	size_t i;
+	for (i = 0; i + width <= count; i += width)
+	{
+		const __m512 a(_mm512_mul_ps(_mm512_sub_ps(_mm512_loadu_ps(input + 2 * i), o), _mm512_loadu_ps(window + 2 * i)));
+		const __m512 b(_mm512_mul_ps(_mm512_sub_ps(_mm512_loadu_ps(input + 2 * i + width), o), _mm512_loadu_ps(window + 2 * i + width)));
+		_mm512_storeu_ps(even + i, _mm512_permutex2var_ps(a, evenIndices, b));
+		_mm512_storeu_ps(odd + i, _mm512_permutex2var_ps(a, oddIndices, b));
+	}
+
+	ScalarWindowPack(input + 2 * i, offset, window + 2 * i, count - i, even + i, odd + i);
+}
+
+FFT_TARGET_SSE2
+void FFTKernels::SSE2RadixFourPass(float* real, float* imaginary,
+	const size_t& size, const size_t& span, const float* twiddleReal,
+	const float* twiddleImaginary)
+{
+	const size_t width(4);
+	if (span < width)
+	{
+		ScalarRadixFourPass(real, imaginary, size, span, twiddleReal, twiddleImaginary);
+		return;
+	}
+
+	const float* w1Real(twiddleReal + span - 1);
+	const float* w1Imaginary(twiddleImaginary + span - 1);
+	const float* w2Real(twiddleReal + 2 * span - 1);
+	const float* w2Imaginary(twiddleImaginary + 2 * span - 1);
+
+	size_t i, j;
+	for (i = 0; i < size; i += 4 * span)
+	{
+		float* r0(real + i);
+		float* r1(r0 + span);
+		float* r2(r1 + span);
+		float* r3(r2 + span);
+		float* i0(imaginary + i);
+		float* i1(i0 + span);
+		float* i2(i1 + span);
+		float* i3(i2 + span);
+
+		for (j = 0; j < span; j += width)
+		{
+			const __m128 w1r(_mm_loadu_ps(w1Real + j)), w1i(_mm_loadu_ps(w1Imaginary + j));
+			const __m128 w2r(_mm_loadu_ps(w2Real + j)), w2i(_mm_loadu_ps(w2Imaginary + j));
+			const __m128 a0r(_mm_loadu_ps(r0 + j)), a0i(_mm_loadu_ps(i0 + j));
+			const __m128 a1r(_mm_loadu_ps(r1 + j)), a1i(_mm_loadu_ps(i1 + j));
+			const __m128 a2r(_mm_loadu_ps(r2 + j)), a2i(_mm_loadu_ps(i2 + j));
+			const __m128 a3r(_mm_loadu_ps(r3 + j)), a3i(_mm_loadu_ps(i3 + j));
+
+			const __m128 t1r(_mm_sub_ps(_mm_mul_ps(w1r, a1r), _mm_mul_ps(w1i, a1i)));
+			const __m128 t1i(_mm_add_ps(_mm_mul_ps(w1r, a1i), _mm_mul_ps(w1i, a1r)));
+			const __m128 t3r(_mm_sub_ps(_mm_mul_ps(w1r, a3r), _mm_mul_ps(w1i, a3i)));
+			const __m128 t3i(_mm_add_ps(_mm_mul_ps(w1r, a3i), _mm_mul_ps(w1i, a3r)));
+
+			const __m128 b0r(_mm_add_ps(a0r, t1r)), b0i(_mm_add_ps(a0i, t1i));
+			const __m128 b1r(_mm_sub_ps(a0r, t1r)), b1i(_mm_sub_ps(a0i, t1i));
+			const __m128 b2r(_mm_add_ps(a2r, t3r)), b2i(_mm_add_ps(a2i, t3i));
+			const __m128 b3r(_mm_sub_ps(a2r, t3r)), b3i(_mm_sub_ps(a2i, t3i));
+
+			const __m128 u2r(_mm_sub_ps(_mm_mul_ps(w2r, b2r), _mm_mul_ps(w2i, b2i)));
+			const __m128 u2i(_mm_add_ps(_mm_mul_ps(w2r, b2i), _mm_mul_ps(w2i, b2r)));
+			const __m128 u3r(_mm_add_ps(_mm_mul_ps(w2r, b3i), _mm_mul_ps(w2i, b3r)));
+			const __m128 u3i(_mm_sub_ps(_mm_mul_ps(w2i, b3i), _mm_mul_ps(w2r, b3r)));
+
+			_mm_storeu_ps(r0 + j, _mm_add_ps(b0r, u2r));
+			_mm_storeu_ps(i0 + j, _mm_add_ps(b0i, u2i));
+			_mm_storeu_ps(r2 + j, _mm_sub_ps(b0r, u2r));
+			_mm_storeu_ps(i2 + j, _mm_sub_ps(b0i, u2i));
+			_mm_storeu_ps(r1 + j, _mm_add_ps(b1r, u3r));
+			_mm_storeu_ps(i1 + j, _mm_add_ps(b1i, u3i));
+			_mm_storeu_ps(r3 + j, _mm_sub_ps(b1r, u3r));
+			_mm_storeu_ps(i3 + j, _mm_sub_ps(b1i, u3i));
+		}
+	}
+}
+
+FFT_TARGET_AVX2
+void FFTKernels::AVX2RadixFourPass(float* real, float* imaginary,
+	const size_t& size, const size_t& span, const float* twiddleReal,
+	const float* twiddleImaginary)
+{
+	const size_t width(8);
+	if (span < width)
+	{
+		SSE2RadixFourPass(real, imaginary, size, span, twiddleReal, twiddleImaginary);
+		return;
+	}
+
+	const float* w1Real(twiddleReal + span - 1);
+	const float* w1Imaginary(twiddleImaginary + span - 1);
+	const float* w2Real(twiddleReal + 2 * span - 1);
+	const float* w2Imaginary(twiddleImaginary + 2 * span - 1);
+
+	size_t i, j;
+	for (i = 0; i < size; i += 4 * span)
+	{
+		float* r0(real + i);
+		float* r1(r0 + span);
+		float* r2(r1 + span);
+		float* r3(r2 + span);
+		float* i0(imaginary + i);
+		float* i1(i0 + span);
+		float* i2(i1 + span);
+		float* i3(i2 + span);
+
+		for (j = 0; j < span; j += width)
+		{
+			const __m256 w1r(_mm256_loadu_ps(w1Real + j)), w1i(_mm256_loadu_ps(w1Imaginary + j));
+			const __m256 w2r(_mm256_loadu_ps(w2Real + j)), w2i(_mm256_loadu_ps(w2Imaginary + j));
+			const __m256 a0r(_mm256_loadu_ps(r0 + j)), a0i(_mm256_loadu_ps(i0 + j));
+			const __m256 a1r(_mm256_loadu_ps(r1 + j)), a1i(_mm256_loadu_ps(i1 + j));
+			const __m256 a2r(_mm256_loadu_ps(r2 + j)), a2i(_mm256_loadu_ps(i2 + j));
+			const __m256 a3r(_mm256_loadu_ps(r3 + j)), a3i(_mm256_loadu_ps(i3 + j));
+
+			const __m256 t1r(_mm256_sub_ps(_mm256_mul_ps(w1r, a1r), _mm256_mul_ps(w1i, a1i)));
+			const __m256 t1i(_mm256_add_ps(_mm256_mul_ps(w1r, a1i), _mm256_mul_ps(w1i, a1r)));
+			const __m256 t3r(_mm256_sub_ps(_mm256_mul_ps(w1r, a3r), _mm256_mul_ps(w1i, a3i)));
+			const __m256 t3i(_mm256_add_ps(_mm256_mul_ps(w1r, a3i), _mm256_mul_ps(w1i, a3r)));
+
+			const __m256 b0r(_mm256_add_ps(a0r, t1r)), b0i(_mm256_add_ps(a0i, t1i));
+			const __m256 b1r(_mm256_sub_ps(a0r, t1r)), b1i(_mm256_sub_ps(a0i, t1i));
+			const __m256 b2r(_mm256_add_ps(a2r, t3r)), b2i(_mm256_add_ps(a2i, t3i));
+			const __m256 b3r(_mm256_sub_ps(a2r, t3r)), b3i(_mm256_sub_ps(a2i, t3i));
+
+			const __m256 u2r(_mm256_sub_ps(_mm256_mul_ps(w2r, b2r), _mm256_mul_ps(w2i, b2i)));
+			const __m256 u2i(_mm256_add_ps(_mm256_mul_ps(w2r, b2i), _mm256_mul_ps(w2i, b2r)));
+			const __m256 u3r(_mm256_add_ps(_mm256_mul_ps(w2r, b3i), _mm256_mul_ps(w2i, b3r)));
+			const __m256 u3i(_mm256_sub_ps(_mm256_mul_ps(w2i, b3i), _mm256_mul_ps(w2r, b3r)));
+
+			_mm256_storeu_ps(r0 + j, _mm256_add_ps(b0r, u2r));
+			_mm256_storeu_ps(i0 + j, _mm256_add_ps(b0i, u2i));
+			_mm256_storeu_ps(r2 + j, _mm256_sub_ps(b0r, u2r));
+			_mm256_storeu_ps(i2 + j, _mm256_sub_ps(b0i, u2i));
+			_mm256_storeu_ps(r1 + j, _mm256_add_ps(b1r, u3r));
+			_mm256_storeu_ps(i1 + j, _mm256_add_ps(b1i, u3i));
+			_mm256_storeu_ps(r3 + j, _mm256_sub_ps(b1r, u3r));
+			_mm256_storeu_ps(i3 + j, _mm256_sub_ps(b1i, u3i));
+		}
+	}
+}
+
+FFT_TARGET_AVX512
+void FFTKernels::AVX512RadixFourPass(float* real, float* imaginary,
+	const size_t& size, const size_t& span, const float* twiddleReal,
+	const float* twiddleImaginary)
+{
+	const size_t width(16);
+	if (span < width)
+	{
+		// AVX-512F implies AVX2
+		AVX2RadixFourPass(real, imaginary, size, span, twiddleReal, twiddleImaginary);
+		return;
+	}
+
+	const float* w1Real(twiddleReal + span - 1);
+	const float* w1Imaginary(twiddleImaginary + span - 1);
+	const float* w2Real(twiddleReal + 2 * span - 1);
+	const float* w2Imaginary(twiddleImaginary + 2 * span - 1);
+
+	size_t i, j;
+	for (i = 0; i < size; i += 4 * span)
+	{
+		float* r0(real + i);
+		float* r1(r0 + span);
+		float* r2(r1 + span);
+		float* r3(r2 + span);
+		float* i0(imaginary + i);
+		float* i1(i0 + span);
+		float* i2(i1 + span);
+		float* i3(i2 + span);
+
+		for (j = 0; j < span; j += width)
+		{
+			const __m512 w1r(_mm512_loadu_ps(w1Real + j)), w1i(_mm512_loadu_ps(w1Imaginary + j));
+			const __m512 w2r(_mm512_loadu_ps(w2Real + j)), w2i(_mm512_loadu_ps(w2Imaginary + j));
+			const __m512 a0r(_mm512_loadu_ps(r0 + j)), a0i(_mm512_loadu_ps(i0 + j));
+			const __m512 a1r(_mm512_loadu_ps(r1 + j)), a1i(_mm512_loadu_ps(i1 + j));
+			const __m512 a2r(_mm512_loadu_ps(r2 + j)), a2i(_mm512_loadu_ps(i2 + j));
+			const __m512 a3r(_mm512_loadu_ps(r3 + j)), a3i(_mm512_loadu_ps(i3 + j));
+
+			const __m512 t1r(_mm512_sub_ps(_mm512_mul_ps(w1r, a1r), _mm512_mul_ps(w1i, a1i)));
+			const __m512 t1i(_mm512_add_ps(_mm512_mul_ps(w1r, a1i), _mm512_mul_ps(w1i, a1r)));
+			const __m512 t3r(_mm512_sub_ps(_mm512_mul_ps(w1r, a3r), _mm512_mul_ps(w1i, a3i)));
+			const __m512 t3i(_mm512_add_ps(_mm512_mul_ps(w1r, a3i), _mm512_mul_ps(w1i, a3r)));
+
+			const __m512 b0r(_mm512_add_ps(a0r, t1r)), b0i(_mm512_add_ps(a0i, t1i));
+			const __m512 b1r(_mm512_sub_ps(a0r, t1r)), b1i(_mm512_sub_ps(a0i, t1i));
+			const __m512 b2r(_mm512_add_ps(a2r, t3r)), b2i(_mm512_add_ps(a2i, t3i));
+			const __m512 b3r(_mm512_sub_ps(a2r, t3r)), b3i(_mm512_sub_ps(a2i, t3i));
+
+			const __m512 u2r(_mm512_sub_ps(_mm512_mul_ps(w2r, b2r), _mm512_mul_ps(w2i, b2i)));
+			const __m512 u2i(_mm512_add_ps(_mm512_mul_ps(w2r, b2i), _mm512_mul_ps(w2i, b2r)));
+			const __m512 u3r(_mm512_add_ps(_mm512_mul_ps(w2r, b3i), _mm512_mul_ps(w2i, b3r)));
+			const __m512 u3i(_mm512_sub_ps(_mm512_mul_ps(w2i, b3i), _mm512_mul_ps(w2r, b3r)));
+
+			_mm512_storeu_ps(r0 + j, _mm512_add_ps(b0r, u2r));
+			_mm512_storeu_ps(i0 + j, _mm512_add_ps(b0i, u2i));
+			_mm512_storeu_ps(r2 + j, _mm512_sub_ps(b0r, u2r));
+			_mm512_storeu_ps(i2 + j, _mm512_sub_ps(b0i, u2i));
+			_mm512_storeu_ps(r1 + j, _mm512_add_ps(b1r, u3r));
+			_mm512_storeu_ps(i1 + j, _mm512_add_ps(b1i, u3i));
+			_mm512_storeu_ps(r3 + j, _mm512_sub_ps(b1r, u3r));
+			_mm512_storeu_ps(i3 + j, _mm512_sub_ps(b1i, u3i));
+		}
+	}
+}
+
+#else
+
+// Without x86 intrinsics, all kernels use the portable implementation
+
+void FFTKernels::SSE2WindowPack(const float* input, const float& offset,
+	const float* window, const size_t& count, float* even, float* odd)
+{
+	ScalarWindowPack(input, offset, window, count, even, odd);
+}
+
+void FFTKernels::AVX2WindowPack(const float* input, const float& offset,
+	const float* window, const size_t& count, float* even, float* odd)
+{
+	ScalarWindowPack(input, offset, window, count, even, odd);
+}
+
+void FFTKernels::AVX512WindowPack(const float* input, const float& offset,
+	const float* window, const size_t& count, float* even, float* odd)
+{
+	ScalarWindowPack(input, offset, window, count, even, odd);
+}
+
+void FFTKernels::SSE2RadixFourPass(float* real, float* imaginary,
+	const size_t& size, const size_t& span, const float* twiddleReal,
+	const float* twiddleImaginary)
+{
+	ScalarRadixFourPass(real, imaginary, size, span, twiddleReal, twiddleImaginary);
+}
+
+void FFTKernels::AVX2RadixFourPass(float* real, float* imaginary,
+	const size_t& size, const size_t& span, const float* twiddleReal,
+	const float* twiddleImaginary)
+{
+	ScalarRadixFourPass(real, imaginary, size, span, twiddleReal, twiddleImaginary);
+}
+
+void FFTKernels::AVX512RadixFourPass(float* real, float* imaginary,
+	const size_t& size, const size_t& span, const float* twiddleReal,
+	const float* twiddleImaginary)
+{
+	ScalarRadixFourPass(real, imaginary, size, span, twiddleReal, twiddleImaginary);
+}
+
+#endif// FFT_KERNELS_X86
+
+template void FFTKernels::RadixTwoFirstPass<float>(float*, float*, const size_t&);
+template void FFTKernels::RadixTwoFirstPass<double>(double*, double*, const size_t&);
+template void FFTKernels::MixedRadixPass<float>(float*, float*, const size_t&, const size_t&,
+	const unsigned int&, const float*, const float*);
+template void FFTKernels::MixedRadixPass<double>(double*, double*, const size_t&, const size_t&,
+	const unsigned int&, const double*, const double*);
@@ -0,0 +1,171 @@
+// File:  fftKernels.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Vectorized butterfly kernels for FFTPlan, selected at runtime.
+
+#ifndef FFT_KERNELS_H_
+#define FFT_KERNELS_H_
+
+// Standard C++ headers
+#include <string>
+#include <cstddef>
+
+/// Collection of butterfly kernels operating on split (separate real and
+/// imaginary) arrays.  Each kernel performs two radix-2 decimation-in-time
+/// stages (spans s and 2s) in a single pass over the data, which is
+/// equivalent to a radix-4 pass.  Vectorized kernels process adjacent
+/// butterflies in parallel and fall back to the scalar kernel for spans
+/// shorter than the vector width.  Kernels are templated on the sample type;
+/// vectorized kernels are only available for float (double precision
+/// transforms use the scalar kernels).
+class FFTKernels
+{
+public:
+	/// Enumeration of instruction sets for which kernels are available.
+	enum class InstructionSet
+	{
+		Scalar,///< Portable C++ (no vectorization)
+		SSE2,///< Four floats per operation
+		AVX2,///< Eight floats per operation
+		AVX512///< Sixteen floats per operation
+	};
+
+	/// Pointer to a function that performs a fused two-stage pass.
+	///
+	/// \param real             Real parts of the data (modified in place).
+	/// \param imaginary        Imaginary parts of the data (modified in
+	///                         place).
+	/// \param size             Number of complex points.
+	/// \param span             Butterfly span of the first of the two
+	///                         stages.
+	/// \param twiddleReal      Per-stage twiddle factor table (real parts)
+	///                         in which the table for the stage with span s
+	///                         begins at index s - 1.
+	/// \param twiddleImaginary Per-stage twiddle factor table (imaginary
+	///                         parts).
+	template <typename T>
+	using RadixFourPass = void (*)(T* real, T* imaginary,
+		const size_t& size, const size_t& span, const T* twiddleReal,
+		const T* twiddleImaginary);
+
+	/// Pointer to a function that prepares real samples for the half-size
+	/// complex transform:  An offset is removed from each sample, the result
+	/// is multiplied by the window coefficients, and the even and odd samples
+	/// are separated.
+	///
+	/// \param input  Array of 2 * \p count samples.
+	/// \param offset Value to subtract from each sample.
+	/// \param window Array of 2 * \p count window coefficients.
+	/// \param count  Number of pairs of samples.
+	/// \param even   Array in which the \p count windowed even samples are
+	///               stored.
+	/// \param odd    Array in which the \p count windowed odd samples are
+	///               stored.
+	template <typename T>
+	using WindowPack = void (*)(const T* input, const T& offset,
+		const T* window, const size_t& count, T* even, T* odd);
+
+	/// Determines the most capable instruction set supported by both the
+	/// compiler and the CPU on which we are running.  The check is performed
+	/// only once.
+	/// \returns The best supported instruction set.
+	static InstructionSet GetSupportedInstructionSet();
+
+	/// Returns the fused two-stage kernel for the specified instruction set.
+	///
+	/// \param set Instruction set for which the kernel is desired.
+	///
+	/// \returns The kernel for \p set.
+	template <typename T>
+	static RadixFourPass<T> GetRadixFourPass(const InstructionSet& set);
+
+	/// Returns the windowing and packing kernel for the specified
+	/// instruction set.
+	///
+	/// \param set Instruction set for which the kernel is desired.
+	///
+	/// \returns The kernel for \p set.
+	template <typename T>
+	static WindowPack<T> GetWindowPack(const InstructionSet& set);
+
+	/// Performs a single radix-2 stage with span 1 (all twiddle factors are
+	/// unity).  Used when the transform has an odd number of stages.
+	///
+	/// \param real      Real parts of the data (modified in place).
+	/// \param imaginary Imaginary parts of the data (modified in place).
+	/// \param size      Number of complex points.
+	template <typename T>
+	static void RadixTwoFirstPass(T* real, T* imaginary,
+		const size_t& size);
+
+	/// Largest radix supported by MixedRadixPass().
+	static const unsigned int maxMixedRadix;
+
+	/// Performs one decimation-in-time stage of any radix up to
+	/// maxMixedRadix (scalar only).  Used for transform sizes which are not
+	/// powers of two.
+	///
+	/// \param real             Real parts of the data (modified in place).
+	/// \param imaginary        Imaginary parts of the data (modified in
+	///                         place).
+	/// \param size             Number of complex points.
+	/// \param span             Distance between the inputs to each
+	///                         butterfly (product of the radices of the
+	///                         preceding stages).
+	/// \param radix            Number of inputs to each butterfly.
+	/// \param twiddleReal      Twiddle factor table for this stage (real
+	///                         parts), in which the factor for input q of
+	///                         butterfly j is at index (q - 1) * span + j.
+	/// \param twiddleImaginary Twiddle factor table for this stage
+	///                         (imaginary parts).
+	template <typename T>
+	static void MixedRadixPass(T* real, T* imaginary,
+		const size_t& size, const size_t& span, const unsigned int& radix,
+		const T* twiddleReal, const T* twiddleImaginary);
+
+	/// Returns a string describing the specified instruction set.
+	///
+	/// \param set Instruction set.
+	///
+	/// \returns The name of \p set.
+	static std::string GetName(const InstructionSet& set);
+
+private:
+	template <typename T>
+	static void ScalarRadixFourPass(T* real, T* imaginary,
+		const size_t& size, const size_t& span, const T* twiddleReal,
+		const T* twiddleImaginary);
+	static void SSE2RadixFourPass(float* real, float* imaginary,
+		const size_t& size, const size_t& span, const float* twiddleReal,
+		const float* twiddleImaginary);
+	static void AVX2RadixFourPass(float* real, float* imaginary,
+		const size_t& size, const size_t& span, const float* twiddleReal,
+		const float* twiddleImaginary);
+	static void AVX512RadixFourPass(float* real, float* imaginary,
+		const size_t& size, const size_t& span, const float* twiddleReal,
+		const float* twiddleImaginary);
+
+	template <typename T>
+	static void ScalarWindowPack(const T* input, const T& offset,
+		const T* window, const size_t& count, T* even, T* odd);
+	static void SSE2WindowPack(const float* input, const float& offset,
+		const float* window, const size_t& count, float* even, float* odd);
+	static void AVX2WindowPack(const float* input, const float& offset,
+		const float* window, const size_t& count, float* even, float* odd);
+	static void AVX512WindowPack(const float* input, const float& offset,
+		const float* window, const size_t& count, float* even, float* odd);
+
+	static InstructionSet DetectInstructionSet();
+};
+
+template <>
+FFTKernels::RadixFourPass<float> FFTKernels::GetRadixFourPass<float>(const InstructionSet& set);
+template <>
+FFTKernels::RadixFourPass<double> FFTKernels::GetRadixFourPass<double>(const InstructionSet& set);
+
+template <>
+FFTKernels::WindowPack<float> FFTKernels::GetWindowPack<float>(const InstructionSet& set);
+template <>
+FFTKernels::WindowPack<double> FFTKernels::GetWindowPack<double>(const InstructionSet& set);
+
+#endif// FFT_KERNELS_H_
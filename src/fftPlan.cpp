@@ -0,0 +1,983 @@
+// File:  fftPlan.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Precomputed tables for repeated real-input FFTs of a fixed size.
+
+// Local headers
+#include "fftPlan.h"
+
+// Standard C++ headers
+#include <cmath>
+#include <cassert>
+#include <map>
+#include <list>
+#include <mutex>
+#include <utility>
+#include <numeric>
+#include <algorithm>
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		LoadWindowCoefficients (static)
+//
+// Description:		Returns the window coefficients in the plan's sample
+//					type.  Single precision plans share the cached
+//					coefficients; other plans evaluate the window in double
+//					precision (the cache holds single precision values).
+//
+// Input Arguments:
+//		window	= const FastFourierTransform::WindowType&
+//		size	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::shared_ptr<const std::vector<T>>
+//
+//=============================================================================
+template <typename T>
+std::shared_ptr<const std::vector<T>> BasicFFTPlan<T>::LoadWindowCoefficients(
+	const FastFourierTransform::WindowType& window, const size_t& size)
+{
+	const std::vector<double> coefficients(FastFourierTransform::ComputeDoubleWindowCoefficients(window, size));
+	return std::make_shared<const std::vector<T>>(coefficients.begin(), coefficients.end());
+}
+
+template <>
+std::shared_ptr<const std::vector<DatasetType>> BasicFFTPlan<DatasetType>::LoadWindowCoefficients(
+	const FastFourierTransform::WindowType& window, const size_t& size)
+{
+	return FastFourierTransform::GetWindowCoefficients(window, size);
+}
+
+template <typename T>
+BasicFFTPlan<T>::BasicFFTPlan(const size_t& size, const FastFourierTransform::WindowType& window)
+	: size(size), halfSize(size / 2), window(window), algorithm(ChooseAlgorithm(size / 2)),
+	windowCoefficients(LoadWindowCoefficients(window, size)),
+	radixFourPass(FFTKernels::GetRadixFourPass<T>(FFTKernels::GetSupportedInstructionSet())),
+	windowPack(FFTKernels::GetWindowPack<T>(FFTKernels::GetSupportedInstructionSet()))
+{
+	assert(size >= 2 && size % 2 == 0);
+
+	if (algorithm == Algorithm::PowerOfTwo)
+	{
+		ComputeBitReversedIndices();
+		ComputeTwiddleFactors();
+	}
+	else if (algorithm == Algorithm::MixedRadix)
+	{
+		ComputeRadices();
+		ComputeDigitReversedIndices();
+		ComputeMixedRadixTwiddleFactors();
+	}
+	else
+	{
+		reversedIndices.resize(halfSize);
+		std::iota(reversedIndices.begin(), reversedIndices.end(), 0);
+		ComputeChirp();
+	}
+
+	ComputeSplitTwiddleFactors();
+}
+
+template <typename T>
+BasicFFTPlan<T>::Workspace::Workspace(const BasicFFTPlan& plan) : packedReal(plan.halfSize),
+	packedImaginary(plan.halfSize), real(plan.GetNumberOfBins()), imaginary(plan.GetNumberOfBins()),
+	convolutionReal(plan.convolutionPlan ? plan.convolutionPlan->GetSize() / 2 : 0),
+	convolutionImaginary(convolutionReal.size())
+{
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		Get (static)
+//
+// Description:		Returns a cached plan matching the specified parameters,
+//					creating one if necessary.  The most recently used plans
+//					are retained so that repeated calls with the same
+//					parameters do not recompute any tables.
+//
+// Input Arguments:
+//		size	= const size_t&
+//		window	= const FastFourierTransform::WindowType&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::shared_ptr<const BasicFFTPlan>
+//
+//=============================================================================
+template <typename T>
+std::shared_ptr<const BasicFFTPlan<T>> BasicFFTPlan<T>::Get(const size_t& size,
+	const FastFourierTransform::WindowType& window)
+{
+	typedef std::pair<size_t, FastFourierTransform::WindowType> Key;
+	typedef std::pair<Key, std::shared_ptr<const BasicFFTPlan>> Entry;
+	const size_t maxCachedPlans(16);
+
+	static std::mutex cacheMutex;
+	static std::list<Entry> cache;// Most recently used at front
+
+	const Key key(size, window);
+	const auto find([&key]()
+	{
+		for (auto it = cache.begin(); it != cache.end(); ++it)
+		{
+			if (it->first == key)
+			{
+				cache.splice(cache.begin(), cache, it);
+				return cache.front().second;
+			}
+		}
+
+		return std::shared_ptr<const BasicFFTPlan>();
+	});
+
+	{
+		std::lock_guard<std::mutex> lock(cacheMutex);
+		const auto plan(find());
+		if (plan)
+			return plan;
+	}
+
+	// Create the plan without holding the lock, since plans using Bluestein's
+	// algorithm get another plan from the cache
+	auto plan(std::make_shared<const BasicFFTPlan>(size, window));
+
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	const auto existingPlan(find());// In case another thread created one in the meantime
+	if (existingPlan)
+		return existingPlan;
+
+	cache.emplace_front(key, plan);
+	if (cache.size() > maxCachedPlans)
+		cache.pop_back();
+
+	return plan;
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		IsSmooth (static)
+//
+// Description:		Checks whether the specified size can be factored into
+//					the radices supported by the mixed radix stages.
+//
+// Input Arguments:
+//		size	= size_t
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//=============================================================================
+template <typename T>
+bool BasicFFTPlan<T>::IsSmooth(size_t size)
+{
+	if (size == 0)
+		return false;
+
+	for (const size_t factor : { 2, 3, 5, 7 })
+	{
+		while (size % factor == 0)
+			size /= factor;
+	}
+
+	return size == 1;
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		ChooseAlgorithm (static)
+//
+// Description:		Selects the method used for the half-size complex
+//					transform.
+//
+// Input Arguments:
+//		halfSize	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		Algorithm
+//
+//=============================================================================
+template <typename T>
+typename BasicFFTPlan<T>::Algorithm BasicFFTPlan<T>::ChooseAlgorithm(const size_t& halfSize)
+{
+	if ((halfSize & (halfSize - 1)) == 0)
+		return Algorithm::PowerOfTwo;
+	else if (IsSmooth(halfSize))
+		return Algorithm::MixedRadix;
+	return Algorithm::Bluestein;
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		ComputeBitReversedIndices
+//
+// Description:		Computes the bit-reversed index of each point in the
+//					half-size complex transform.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicFFTPlan<T>::ComputeBitReversedIndices()
+{
+	reversedIndices.resize(halfSize);
+
+	size_t i, j(0);
+	for (i = 0; i < halfSize; ++i)
+	{
+		reversedIndices[i] = j;
+
+		size_t k(halfSize >> 1);
+		while (k > 0 && k <= j)
+		{
+			j -= k;
+			k >>= 1;
+		}
+
+		j += k;
+	}
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		ComputeTwiddleFactors
+//
+// Description:		Computes the twiddle factors for each stage of the
+//					half-size (power of two) complex transform.  Each factor
+//					is computed directly (in double precision) rather than
+//					with a recurrence to avoid accumulating error.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicFFTPlan<T>::ComputeTwiddleFactors()
+{
+	if (halfSize > 1)
+	{
+		stageTwiddleReal.resize(halfSize - 1);
+		stageTwiddleImaginary.resize(halfSize - 1);
+	}
+
+	size_t span, j;
+	for (span = 1; span < halfSize; span <<= 1)
+	{
+		for (j = 0; j < span; ++j)
+		{
+			const double angle(-M_PI * j / span);
+			stageTwiddleReal[span - 1 + j] = static_cast<T>(cos(angle));
+			stageTwiddleImaginary[span - 1 + j] = static_cast<T>(sin(angle));
+		}
+	}
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		ComputeRadices
+//
+// Description:		Factors the half size into the radices of the mixed
+//					radix stages.  Radix 4 is preferred over two radix 2
+//					stages, since it requires fewer passes over the data.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicFFTPlan<T>::ComputeRadices()
+{
+	size_t remaining(halfSize);
+	for (const unsigned int radix : { 4, 2, 3, 5, 7 })
+	{
+		while (remaining % radix == 0)
+		{
+			radices.push_back(radix);
+			remaining /= radix;
+		}
+	}
+
+	assert(remaining == 1);
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		ComputeDigitReversedIndices
+//
+// Description:		Computes the location of each input point for the mixed
+//					radix transform (the generalization of bit reversal).
+//					The last stage combines sub-transforms of the points
+//					whose indices have the same remainder when divided by
+//					its radix p; the sub-transform for remainder q occupies
+//					the q-th block of N / (2 * p) points.  The same rule is
+//					applied recursively within each block for the preceding
+//					stages.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicFFTPlan<T>::ComputeDigitReversedIndices()
+{
+	reversedIndices.resize(halfSize);
+
+	size_t i;
+	for (i = 0; i < halfSize; ++i)
+	{
+		size_t index(i), blockSize(halfSize), position(0);
+		for (auto radix = radices.rbegin(); radix != radices.rend(); ++radix)
+		{
+			blockSize /= *radix;
+			position += (index % *radix) * blockSize;
+			index /= *radix;
+		}
+
+		reversedIndices[i] = position;
+	}
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		ComputeMixedRadixTwiddleFactors
+//
+// Description:		Computes the twiddle factors for each mixed radix stage.
+//					For a stage with radix p and span s, input q of butterfly
+//					j is multiplied by exp(-2 * pi * i * q * j / (p * s)).
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicFFTPlan<T>::ComputeMixedRadixTwiddleFactors()
+{
+	size_t span(1), j;
+	unsigned int q;
+	for (const auto& radix : radices)
+	{
+		stageTwiddleOffsets.push_back(stageTwiddleReal.size());
+		for (q = 1; q < radix; ++q)
+		{
+			for (j = 0; j < span; ++j)
+			{
+				const double angle(-2.0 * M_PI * q * j / (radix * span));
+				stageTwiddleReal.push_back(static_cast<T>(cos(angle)));
+				stageTwiddleImaginary.push_back(static_cast<T>(sin(angle)));
+			}
+		}
+
+		span *= radix;
+	}
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		ComputeChirp
+//
+// Description:		Computes the tables for Bluestein's algorithm.  With
+//					L = N / 2 and nk = (n^2 + k^2 - (k - n)^2) / 2, the
+//					transform is X[k] = c[k] * sum(x[n] * c[n] * c*[k - n])
+//					with c[n] = exp(-i * pi * n^2 / L), i.e. a convolution
+//					with the conjugate chirp, which is computed with power of
+//					two FFTs.  n^2 is reduced modulo 2 * L so the phase is
+//					accurate for large n.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicFFTPlan<T>::ComputeChirp()
+{
+	size_t convolutionSize(2);
+	while (convolutionSize < 2 * halfSize - 1)
+		convolutionSize <<= 1;
+	convolutionPlan = Get(2 * convolutionSize, FastFourierTransform::WindowType::Uniform);
+
+	chirpReal.resize(halfSize);
+	chirpImaginary.resize(halfSize);
+	std::vector<T> real(convolutionSize, 0.0f), imaginary(convolutionSize, 0.0f);
+	size_t n;
+	for (n = 0; n < halfSize; ++n)
+	{
+		const double angle(-M_PI * ((n * n) % (2 * halfSize)) / halfSize);
+		chirpReal[n] = static_cast<T>(cos(angle));
+		chirpImaginary[n] = static_cast<T>(sin(angle));
+
+		// Conjugate chirp for indices -(L - 1) through L - 1 (negative indices
+		// wrap to the end of the buffer)
+		real[n] = chirpReal[n];
+		imaginary[n] = -chirpImaginary[n];
+		if (n > 0)
+		{
+			real[convolutionSize - n] = real[n];
+			imaginary[convolutionSize - n] = imaginary[n];
+		}
+	}
+
+	convolutionPlan->ExecuteComplex(real.data(), imaginary.data());
+
+	// Fold in the inverse transform scaling
+	const T scale(static_cast<T>(1.0 / convolutionSize));
+	chirpResponseReal.resize(convolutionSize);
+	chirpResponseImaginary.resize(convolutionSize);
+	for (n = 0; n < convolutionSize; ++n)
+	{
+		chirpResponseReal[n] = real[n] * scale;
+		chirpResponseImaginary[n] = imaginary[n] * scale;
+	}
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		ComputeSplitTwiddleFactors
+//
+// Description:		Computes the factors used to split the half-size complex
+//					transform into the spectrum of the real input.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicFFTPlan<T>::ComputeSplitTwiddleFactors()
+{
+	splitTwiddleReal.resize(halfSize);
+	splitTwiddleImaginary.resize(halfSize);
+	size_t j;
+	for (j = 0; j < halfSize; ++j)
+	{
+		const double angle(-M_PI * j / halfSize);
+		splitTwiddleReal[j] = static_cast<T>(cos(angle));
+		splitTwiddleImaginary[j] = static_cast<T>(sin(angle));
+	}
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		Execute
+//
+// Description:		Computes bins 0 through N/2 of the FFT of the specified
+//					real-valued data.  Results are stored in the workspace.
+//
+// Input Arguments:
+//		input		= const T*
+//		offset		= const T&
+//
+// Output Arguments:
+//		workspace	= Workspace&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicFFTPlan<T>::Execute(const T* input, const T& offset,
+	Workspace& workspace) const
+{
+	assert(workspace.packedReal.size() == halfSize);
+
+	Pack(input, offset, workspace);
+	Transform(workspace);
+	Split(workspace);
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		ExecuteInverse
+//
+// Description:		Computes the real-valued data corresponding to bins 0
+//					through N/2 (stored in the workspace).  Uses the forward
+//					transform, since the inverse of Z is the conjugate of the
+//					forward transform of Z*, divided by the size.
+//
+// Input Arguments:
+//		workspace	= Workspace&
+//
+// Output Arguments:
+//		workspace	= Workspace&
+//		output		= T*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicFFTPlan<T>::ExecuteInverse(Workspace& workspace, T* output) const
+{
+	assert(workspace.packedReal.size() == halfSize);
+
+	Merge(workspace);
+	Transform(workspace);
+	Unpack(workspace, output);
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		ExecuteComplex
+//
+// Description:		Computes the FFT of N/2 complex points in place.  Input
+//					points are moved to their bit-reversed locations before
+//					the transform.
+//
+// Input Arguments:
+//		real		= T*
+//		imaginary	= T*
+//
+// Output Arguments:
+//		real		= T*
+//		imaginary	= T*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicFFTPlan<T>::ExecuteComplex(T* real, T* imaginary) const
+{
+	assert(algorithm == Algorithm::PowerOfTwo);
+
+	BitReverse(real, imaginary);
+	RadixTwoTransform(real, imaginary);
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		BitReverse
+//
+// Description:		Moves each point of the half-size complex array to its
+//					bit-reversed location in place.  Only valid for power of
+//					two plans (digit reversal is not its own inverse, so it
+//					can not be done by swapping pairs).
+//
+// Input Arguments:
+//		real		= T*
+//		imaginary	= T*
+//
+// Output Arguments:
+//		real		= T*
+//		imaginary	= T*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicFFTPlan<T>::BitReverse(T* real, T* imaginary) const
+{
+	size_t i;
+	for (i = 0; i < halfSize; ++i)
+	{
+		const size_t target(reversedIndices[i]);
+		if (i < target)
+		{
+			std::swap(real[i], real[target]);
+			std::swap(imaginary[i], imaginary[target]);
+		}
+	}
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		Pack
+//
+// Description:		Windows the real input data and packs it into a
+//					half-size complex array (even samples are the real parts
+//					and odd samples the imaginary parts).  For power of two
+//					and Bluestein plans, the vectorized kernel windows and
+//					packs the data in natural order, which is then
+//					bit-reversed in place if required.  Mixed radix points
+//					are written directly to their digit-reversed locations.
+//
+// Input Arguments:
+//		input		= const T*
+//		offset		= const T&
+//
+// Output Arguments:
+//		workspace	= Workspace&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicFFTPlan<T>::Pack(const T* input, const T& offset,
+	Workspace& workspace) const
+{
+	const T* coefficients(windowCoefficients->data());
+	if (algorithm != Algorithm::MixedRadix)
+	{
+		windowPack(input, offset, coefficients, halfSize,
+			workspace.packedReal.data(), workspace.packedImaginary.data());
+		if (algorithm == Algorithm::PowerOfTwo)
+			BitReverse(workspace.packedReal.data(), workspace.packedImaginary.data());
+		return;
+	}
+
+	size_t i;
+	for (i = 0; i < halfSize; ++i)
+	{
+		const size_t target(reversedIndices[i]);
+		workspace.packedReal[target] = (input[2 * i] - offset) * coefficients[2 * i];
+		workspace.packedImaginary[target] = (input[2 * i + 1] - offset) * coefficients[2 * i + 1];
+	}
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		Transform
+//
+// Description:		Performs the half-size complex FFT of the packed data in
+//					the workspace (in place) using the algorithm selected for
+//					this plan.
+//
+// Input Arguments:
+//		workspace	= Workspace&
+//
+// Output Arguments:
+//		workspace	= Workspace&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicFFTPlan<T>::Transform(Workspace& workspace) const
+{
+	switch (algorithm)
+	{
+	case Algorithm::PowerOfTwo:
+		RadixTwoTransform(workspace.packedReal.data(), workspace.packedImaginary.data());
+		break;
+
+	case Algorithm::MixedRadix:
+		MixedRadixTransform(workspace.packedReal.data(), workspace.packedImaginary.data());
+		break;
+
+	case Algorithm::Bluestein:
+		BluesteinTransform(workspace);
+		break;
+	}
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		RadixTwoTransform
+//
+// Description:		Performs the in-place, decimation-in-time complex FFT on
+//					bit-reversed data using the precomputed twiddle factors.
+//					Stages are processed in pairs by the (vectorized) radix-4
+//					kernel; if the number of stages is odd, the first stage
+//					(which needs no twiddle factors) is done separately.
+//
+// Input Arguments:
+//		real		= T*
+//		imaginary	= T*
+//
+// Output Arguments:
+//		real		= T*
+//		imaginary	= T*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicFFTPlan<T>::RadixTwoTransform(T* real, T* imaginary) const
+{
+	unsigned int stageCount(0);
+	size_t span;
+	for (span = 1; span < halfSize; span <<= 1)
+		++stageCount;
+
+	span = 1;
+	if (stageCount % 2 == 1)
+	{
+		FFTKernels::RadixTwoFirstPass(real, imaginary, halfSize);
+		span = 2;
+	}
+
+	for (; span < halfSize; span <<= 2)
+		radixFourPass(real, imaginary, halfSize, span,
+			stageTwiddleReal.data(), stageTwiddleImaginary.data());
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		MixedRadixTransform
+//
+// Description:		Performs the in-place, decimation-in-time complex FFT on
+//					digit-reversed data, one stage per radix.
+//
+// Input Arguments:
+//		real		= T*
+//		imaginary	= T*
+//
+// Output Arguments:
+//		real		= T*
+//		imaginary	= T*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicFFTPlan<T>::MixedRadixTransform(T* real, T* imaginary) const
+{
+	size_t span(1), i;
+	for (i = 0; i < radices.size(); ++i)
+	{
+		FFTKernels::MixedRadixPass(real, imaginary, halfSize, span, radices[i],
+			stageTwiddleReal.data() + stageTwiddleOffsets[i],
+			stageTwiddleImaginary.data() + stageTwiddleOffsets[i]);
+		span *= radices[i];
+	}
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		BluesteinTransform
+//
+// Description:		Performs the complex FFT of the (naturally ordered)
+//					packed data in the workspace using Bluestein's algorithm.
+//					The inverse transform of the product of spectra is
+//					computed as the conjugate of the forward transform of its
+//					conjugate.
+//
+// Input Arguments:
+//		workspace	= Workspace&
+//
+// Output Arguments:
+//		workspace	= Workspace&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicFFTPlan<T>::BluesteinTransform(Workspace& workspace) const
+{
+	assert(workspace.convolutionReal.size() == chirpResponseReal.size());
+
+	T* real(workspace.packedReal.data());
+	T* imaginary(workspace.packedImaginary.data());
+	T* convolutionReal(workspace.convolutionReal.data());
+	T* convolutionImaginary(workspace.convolutionImaginary.data());
+
+	size_t i;
+	for (i = 0; i < halfSize; ++i)
+	{
+		convolutionReal[i] = real[i] * chirpReal[i] - imaginary[i] * chirpImaginary[i];
+		convolutionImaginary[i] = real[i] * chirpImaginary[i] + imaginary[i] * chirpReal[i];
+	}
+
+	std::fill(workspace.convolutionReal.begin() + halfSize, workspace.convolutionReal.end(), static_cast<T>(0.0));
+	std::fill(workspace.convolutionImaginary.begin() + halfSize, workspace.convolutionImaginary.end(), static_cast<T>(0.0));
+	convolutionPlan->ExecuteComplex(convolutionReal, convolutionImaginary);
+
+	const size_t convolutionSize(workspace.convolutionReal.size());
+	for (i = 0; i < convolutionSize; ++i)
+	{
+		const T productReal(convolutionReal[i] * chirpResponseReal[i] - convolutionImaginary[i] * chirpResponseImaginary[i]);
+		const T productImaginary(convolutionReal[i] * chirpResponseImaginary[i] + convolutionImaginary[i] * chirpResponseReal[i]);
+		convolutionReal[i] = productReal;
+		convolutionImaginary[i] = -productImaginary;
+	}
+
+	convolutionPlan->ExecuteComplex(convolutionReal, convolutionImaginary);
+
+	// Multiply the conjugate of the convolution by the chirp
+	for (i = 0; i < halfSize; ++i)
+	{
+		real[i] = convolutionReal[i] * chirpReal[i] + convolutionImaginary[i] * chirpImaginary[i];
+		imaginary[i] = convolutionReal[i] * chirpImaginary[i] - convolutionImaginary[i] * chirpReal[i];
+	}
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		Split
+//
+// Description:		Recovers the spectrum of N real points from the N/2-point
+//					complex transform of the packed data.  With Z the
+//					transform of the packed data, the even and odd sample
+//					spectra are E[k] = (Z[k] + Z*[N/2 - k]) / 2 and
+//					O[k] = -i * (Z[k] - Z*[N/2 - k]) / 2, and the result is
+//					X[k] = E[k] + exp(-2 * pi * i * k / N) * O[k].
+//
+// Input Arguments:
+//		workspace	= Workspace&
+//
+// Output Arguments:
+//		workspace	= Workspace&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicFFTPlan<T>::Split(Workspace& workspace) const
+{
+	const T* zReal(workspace.packedReal.data());
+	const T* zImaginary(workspace.packedImaginary.data());
+
+	workspace.real[0] = zReal[0] + zImaginary[0];
+	workspace.imaginary[0] = 0.0;
+	workspace.real[halfSize] = zReal[0] - zImaginary[0];
+	workspace.imaginary[halfSize] = 0.0;
+
+	size_t k;
+	for (k = 1; k < halfSize; ++k)
+	{
+		const T conjReal(zReal[halfSize - k]);
+		const T conjImaginary(-zImaginary[halfSize - k]);
+
+		const T evenReal(static_cast<T>(0.5) * (zReal[k] + conjReal));
+		const T evenImaginary(static_cast<T>(0.5) * (zImaginary[k] + conjImaginary));
+		const T oddReal(static_cast<T>(0.5) * (zImaginary[k] - conjImaginary));
+		const T oddImaginary(static_cast<T>(-0.5) * (zReal[k] - conjReal));
+
+		workspace.real[k] = evenReal + splitTwiddleReal[k] * oddReal - splitTwiddleImaginary[k] * oddImaginary;
+		workspace.imaginary[k] = evenImaginary + splitTwiddleReal[k] * oddImaginary + splitTwiddleImaginary[k] * oddReal;
+	}
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		Merge
+//
+// Description:		Reverses Split(), computing the half-size complex
+//					spectrum Z[k] = E[k] + i * O[k] of the packed data from
+//					the spectrum X of the real data, where
+//					E[k] = (X[k] + X*[N/2 - k]) / 2 and
+//					O[k] = exp(2 * pi * i * k / N) * (X[k] - X*[N/2 - k]) / 2.
+//					The result is conjugated and scaled (so the forward
+//					transform can be used for the inverse) and stored in
+//					bit-reversed (or digit-reversed) order.
+//
+// Input Arguments:
+//		workspace	= Workspace&
+//
+// Output Arguments:
+//		workspace	= Workspace&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicFFTPlan<T>::Merge(Workspace& workspace) const
+{
+	const T* xReal(workspace.real.data());
+	const T* xImaginary(workspace.imaginary.data());
+	const T scale(static_cast<T>(1.0 / size));// Includes the factor of 1/2 for E and O
+
+	size_t k;
+	for (k = 0; k < halfSize; ++k)
+	{
+		const T conjReal(xReal[halfSize - k]);
+		const T conjImaginary(k == 0 ? 0.0f : -xImaginary[halfSize - k]);
+		const T imaginary(k == 0 ? 0.0f : xImaginary[k]);
+
+		const T evenReal(xReal[k] + conjReal);
+		const T evenImaginary(imaginary + conjImaginary);
+		const T differenceReal(xReal[k] - conjReal);
+		const T differenceImaginary(imaginary - conjImaginary);
+
+		// Multiply the difference by the conjugate of the split twiddle factor
+		const T oddReal(splitTwiddleReal[k] * differenceReal + splitTwiddleImaginary[k] * differenceImaginary);
+		const T oddImaginary(splitTwiddleReal[k] * differenceImaginary - splitTwiddleImaginary[k] * differenceReal);
+
+		// Z = E + i * O, stored as conj(Z)
+		const size_t target(reversedIndices[k]);
+		workspace.packedReal[target] = scale * (evenReal - oddImaginary);
+		workspace.packedImaginary[target] = -scale * (evenImaginary + oddReal);
+	}
+}
+
+//=============================================================================
+// Class:			BasicFFTPlan
+// Function:		Unpack
+//
+// Description:		Extracts the real data from the transformed packed
+//					array.  The transform result is conjugated, so even
+//					samples are the real parts and odd samples are the
+//					negated imaginary parts.
+//
+// Input Arguments:
+//		workspace	= const Workspace&
+//
+// Output Arguments:
+//		output		= T*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicFFTPlan<T>::Unpack(const Workspace& workspace, T* output) const
+{
+	size_t i;
+	for (i = 0; i < halfSize; ++i)
+	{
+		output[2 * i] = workspace.packedReal[i];
+		output[2 * i + 1] = -workspace.packedImaginary[i];
+	}
+}
+
+template class BasicFFTPlan<float>;
+template class BasicFFTPlan<double>;
@@ -0,0 +1,196 @@
+// File:  fftPlan.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Precomputed tables for repeated real-input FFTs of a fixed size.
+
+#ifndef FFT_PLAN_H_
+#define FFT_PLAN_H_
+
+// Local headers
+#include "fft.h"
+#include "fftKernels.h"
+
+// Standard C++ headers
+#include <vector>
+#include <memory>
+
+/// Class containing everything that can be computed once for a real-input
+/// FFT of a given size and window type (window coefficients, bit-reversal
+/// indices and twiddle factors).  The same tables are used for the inverse
+/// transform.  Pairs of real points are packed into a complex transform of
+/// half the size, which uses the vectorized radix-4 kernels when its size is
+/// a power of two, mixed radix (2, 3, 4, 5 and 7) stages when it has no other
+/// prime factors, and Bluestein's algorithm otherwise.  Plans are immutable
+/// once created, so a single plan may be shared between threads; each caller
+/// must provide its own Workspace.
+///
+/// Plans are templated on the sample type.  Single (float) and double
+/// precision plans are explicitly instantiated; double precision plans use
+/// the scalar kernels, but all tables (including the window coefficients)
+/// and arithmetic are in double precision.
+template <typename T>
+class BasicFFTPlan
+{
+public:
+	/// Constructor.  Prefer Get() to take advantage of cached plans.
+	///
+	/// \param size   Number of real input points (must be even).
+	/// \param window Window function to apply to the input.
+	BasicFFTPlan(const size_t& size, const FastFourierTransform::WindowType& window);
+
+	/// Returns a plan for the specified size and window, creating it only if
+	/// a matching plan is not already cached.
+	///
+	/// \param size   Number of real input points (must be even).
+	/// \param window Window function to apply to the input.
+	///
+	/// \returns A shared plan for the specified parameters.
+	static std::shared_ptr<const BasicFFTPlan> Get(const size_t& size,
+		const FastFourierTransform::WindowType& window);
+
+	/// Scratch buffers (stored as separate real and imaginary arrays) used
+	/// when executing a plan.  Buffers are sized once by the constructor, so
+	/// repeated calls to Execute() do not allocate.
+	struct Workspace
+	{
+		Workspace() = default;
+
+		/// Constructor.
+		///
+		/// \param plan Plan with which this workspace will be used.
+		explicit Workspace(const BasicFFTPlan& plan);
+
+		std::vector<T> packedReal;///< Half-size complex transform buffer
+		std::vector<T> packedImaginary;///< Half-size complex transform buffer
+		std::vector<T> real;///< Real part of bins 0 through N/2
+		std::vector<T> imaginary;///< Imaginary part of bins 0 through N/2
+		std::vector<T> convolutionReal;///< Bluestein convolution buffer (empty if not required)
+		std::vector<T> convolutionImaginary;///< Bluestein convolution buffer (empty if not required)
+	};
+
+	/// Windows and transforms the specified data, storing the non-negative
+	/// frequency bins in the workspace.  Results are not scaled.
+	///
+	/// \param input     Array of GetSize() real input points.
+	/// \param offset    Value to subtract from each input point prior to
+	///                  windowing (i.e. the mean, to remove DC content).
+	/// \param workspace Workspace created for this plan.
+	void Execute(const T* input, const T& offset,
+		Workspace& workspace) const;
+
+	/// Computes the real signal having the non-negative frequency bins
+	/// stored in the workspace (the inverse of Execute() with a uniform
+	/// window).  Results are scaled by 1 / N, so a forward transform followed
+	/// by an inverse transform reproduces the input.  The imaginary parts of
+	/// bins 0 and N/2 are assumed to be zero.  Contents of the workspace are
+	/// overwritten.
+	///
+	/// \param workspace Workspace created for this plan, containing the
+	///                  bins to transform.
+	/// \param output    Array of GetSize() points in which the result is
+	///                  stored.
+	void ExecuteInverse(Workspace& workspace, T* output) const;
+
+	/// Computes the complex FFT of GetSize() / 2 points in place (the
+	/// transform used internally for real input).  Results are not scaled.
+	/// The window is not applied.  Only available for plans whose size is a
+	/// power of two.
+	///
+	/// \param real      Array of GetSize() / 2 real parts.
+	/// \param imaginary Array of GetSize() / 2 imaginary parts.
+	void ExecuteComplex(T* real, T* imaginary) const;
+
+	/// \name Private data accessors
+	/// @{
+
+	size_t GetSize() const { return size; }
+	size_t GetNumberOfBins() const { return size / 2 + 1; }
+	FastFourierTransform::WindowType GetWindow() const { return window; }
+	const std::vector<T>& GetWindowCoefficients() const { return *windowCoefficients; }
+
+	/// @}
+
+	/// Returns true if the specified size has no prime factors larger than
+	/// seven (i.e. it can be transformed without Bluestein's algorithm).
+	///
+	/// \param size Size to check.
+	///
+	/// \returns True if the size is seven-smooth.
+	static bool IsSmooth(size_t size);
+
+private:
+	enum class Algorithm
+	{
+		PowerOfTwo,
+		MixedRadix,
+		Bluestein
+	};
+
+	const size_t size;
+	const size_t halfSize;
+	const FastFourierTransform::WindowType window;
+	const Algorithm algorithm;
+
+	const std::shared_ptr<const std::vector<T>> windowCoefficients;
+
+	// Location of each input point prior to the half-size complex transform
+	// (bit-reversed for powers of two, digit-reversed for mixed radix and
+	// natural order for Bluestein)
+	std::vector<size_t> reversedIndices;
+
+	// Twiddle factors for each stage of the half-size transform are stored
+	// contiguously.  For powers of two, the stage with butterfly span s
+	// begins at index s - 1; for mixed radix, stage i begins at
+	// stageTwiddleOffsets[i].
+	std::vector<T> stageTwiddleReal;
+	std::vector<T> stageTwiddleImaginary;
+
+	// Radix of each mixed radix stage, in the order they are performed
+	std::vector<unsigned int> radices;
+	std::vector<size_t> stageTwiddleOffsets;
+
+	// Bluestein's algorithm computes the half-size transform as a convolution
+	// with a chirp, using a power of two plan (whose complex size is at least
+	// twice the half size less one)
+	std::shared_ptr<const BasicFFTPlan> convolutionPlan;
+	std::vector<T> chirpReal;// exp(-i * pi * n^2 / (N / 2))
+	std::vector<T> chirpImaginary;
+	std::vector<T> chirpResponseReal;// Scaled spectrum of the conjugate chirp
+	std::vector<T> chirpResponseImaginary;
+
+	// Twiddle factors for splitting the half-size transform into N/2 + 1 bins
+	std::vector<T> splitTwiddleReal;
+	std::vector<T> splitTwiddleImaginary;
+
+	// Kernels for the best instruction set available at runtime
+	const FFTKernels::RadixFourPass<T> radixFourPass;
+	const FFTKernels::WindowPack<T> windowPack;
+
+	static std::shared_ptr<const std::vector<T>> LoadWindowCoefficients(
+		const FastFourierTransform::WindowType& window, const size_t& size);
+	static Algorithm ChooseAlgorithm(const size_t& halfSize);
+
+	void ComputeBitReversedIndices();
+	void BitReverse(T* real, T* imaginary) const;
+	void ComputeTwiddleFactors();
+	void ComputeRadices();
+	void ComputeDigitReversedIndices();
+	void ComputeMixedRadixTwiddleFactors();
+	void ComputeChirp();
+	void ComputeSplitTwiddleFactors();
+
+	void Pack(const T* input, const T& offset, Workspace& workspace) const;
+	void Transform(Workspace& workspace) const;
+	void RadixTwoTransform(T* real, T* imaginary) const;
+	void MixedRadixTransform(T* real, T* imaginary) const;
+	void BluesteinTransform(Workspace& workspace) const;
+	void Split(Workspace& workspace) const;
+
+	void Merge(Workspace& workspace) const;
+	void Unpack(const Workspace& workspace, T* output) const;
+};
+
+/// Plan using the same precision as the rest of the application.
+typedef BasicFFTPlan<DatasetType> FFTPlan;
+
+#endif// FFT_PLAN_H_
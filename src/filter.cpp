@@ -11,8 +11,11 @@
 #include <cstdlib>
 #include <algorithm>
 #include <functional>
-#include <sstream>
 #include <cassert>
+#include <cmath>
+#include <limits>
+
+const size_t Filter::maxSectionGroupSize;
 
 //=============================================================================
 // Class:			Filter
@@ -53,8 +56,12 @@ Filter& Filter::operator=(const Filter& f)
 
 	mY = f.mY;
 	mU = f.mU;
+	yPosition = f.yPosition;
+	uPosition = f.uPosition;
 	mA = f.mA;
 	mB = f.mB;
+	sections = f.sections;
+	sectionDesignFailed = f.sectionDesignFailed;
 
 	return *this;
 }
@@ -64,12 +71,16 @@ Filter& Filter::operator=(Filter&& f)
 	if (this == &f)
 		return *this;
 
-	sampleRate =f. sampleRate;
+	sampleRate = f.sampleRate;
 
 	mY = std::move(f.mY);
 	mU = std::move(f.mU);
+	yPosition = f.yPosition;
+	uPosition = f.uPosition;
 	mA = std::move(f.mA);
 	mB = std::move(f.mB);
+	sections = std::move(f.sections);
+	sectionDesignFailed = f.sectionDesignFailed;
 
 	return *this;
 }
@@ -103,9 +114,80 @@ Filter::Filter(const double &sampleRate, const std::vector<double> &numerator,
 	: sampleRate(sampleRate)
 {
 	GenerateCoefficients(numerator, denominator);
+	sectionDesignFailed = !GenerateSections(numerator, denominator);
+	if (sectionDesignFailed)
+		sections.clear();
 	Initialize(initialValue);
 }
 
+//=============================================================================
+// Class:			Filter
+// Function:		Filter
+//
+// Description:		Constructor for the Filter class for filters specified by
+//					the poles and zeros of a continuous time filter (s-domain).
+//					Sections are generated directly from the roots; the
+//					direct-form coefficients are computed from the expanded
+//					polynomials.
+//
+// Input Arguments:
+//		sampleRate		= const double& specifying the sampling rate in Hz
+//		zeros			= const std::vector<std::complex<double>>&
+//		poles			= const std::vector<std::complex<double>>&
+//		gain			= const double& ratio of the leading coefficients
+//		initialValue	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+Filter::Filter(const double &sampleRate, const std::vector<std::complex<double>> &zeros,
+	const std::vector<std::complex<double>> &poles, const double &gain,
+	const double &initialValue) : sampleRate(sampleRate)
+{
+	const RootSet zeroSet(SortRoots(zeros));
+	const RootSet poleSet(SortRoots(poles));
+	GenerateCoefficients(ExpandRoots(zeroSet, gain), ExpandRoots(poleSet, 1.0));
+	sectionDesignFailed = !GenerateSections(zeroSet, poleSet, gain, 1.0);
+	if (sectionDesignFailed)
+		sections.clear();
+	Initialize(initialValue);
+}
+
+//=============================================================================
+// Class:			Filter
+// Function:		FromImpulseResponse (static)
+//
+// Description:		Creates a finite impulse response filter with the
+//					specified (discrete-time) coefficients.
+//
+// Input Arguments:
+//		sampleRate		= const double&
+//		impulseResponse	= const std::vector<double>&
+//		initialValue	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		Filter
+//
+//=============================================================================
+Filter Filter::FromImpulseResponse(const double &sampleRate,
+	const std::vector<double> &impulseResponse, const double &initialValue)
+{
+	assert(!impulseResponse.empty());
+
+	Filter f(sampleRate);
+	f.ResizeArrays(impulseResponse.size(), 1);
+	f.mA = impulseResponse;
+	f.Initialize(initialValue);
+	return f;
+}
+
 //=============================================================================
 // Class:			Filter
 // Function:		GenerateCoefficients
@@ -133,11 +215,8 @@ void Filter::GenerateCoefficients(const std::vector<double> &numerator,
 {
 	const unsigned int highestPower(
 		std::max(numerator.size(), denominator.size()) - 1);
-	std::string numString = AssembleZExpression(numerator, highestPower);
-	std::string denString = AssembleZExpression(denominator, highestPower);
-
-	std::vector<double> zNum = CoefficientsFromString(numString);
-	std::vector<double> zDen = CoefficientsFromString(denString);
+	const std::vector<double> zNum(BilinearTransform(numerator, highestPower));
+	const std::vector<double> zDen(BilinearTransform(denominator, highestPower));
 	ResizeArrays(zNum.size(), zDen.size());
 
 	unsigned int i;
@@ -149,9 +228,558 @@ void Filter::GenerateCoefficients(const std::vector<double> &numerator,
 
 //=============================================================================
 // Class:			Filter
-// Function:		AssembleZExpression
-// Description:		Assembles the z-domain expression equivalent to the s-domain
-//					coefficients provided.
+// Function:		GetSettlingLength
+//
+// Description:		Estimates the number of samples required for the effect
+//					of the initial state to decay.  For FIR filters, this is
+//					the length of the impulse response.  The response of each
+//					section decays at least as fast as r^n, where r is the
+//					magnitude of its largest pole.  Section lengths are summed
+//					(rather than taking the maximum), since a transient must
+//					pass through all downstream sections and cascaded sections
+//					with similar poles decay more slowly than any one of them.
+//
+// Input Arguments:
+//		tolerance	= const double&
+//
+// Output Arguments:
+//		length		= size_t&
+//
+// Return Value:
+//		bool, false if the estimate is not available
+//
+//=============================================================================
+bool Filter::GetSettlingLength(const double& tolerance, size_t& length) const
+{
+	if (IsFiniteImpulseResponse())
+	{
+		length = mA.size();// Exact, regardless of tolerance
+		return true;
+	}
+
+	if (sections.empty())
+		return false;
+
+	length = 0;
+	for (const auto& section : sections)
+	{
+		double radius;
+		const double discriminant(section.a1 * section.a1 - 4.0 * section.a2);
+		if (discriminant < 0.0)
+			radius = sqrt(section.a2);
+		else
+			radius = 0.5 * (fabs(section.a1) + sqrt(discriminant));
+
+		if (!(radius < 1.0))
+			return false;
+
+		length += 2;// Section memory
+		if (radius > 0.0)
+			length += static_cast<size_t>(ceil(log(tolerance) / log(radius)));
+	}
+
+	return true;
+}
+
+//=============================================================================
+// Class:			Filter
+// Function:		GenerateSections
+//
+// Description:		Generates a cascade of second-order sections equivalent
+//					to the continuous-time (s-domain) arguments by finding the
+//					poles and zeros of the transfer function.
+//
+// Input Arguments:
+//		numerator	= const std::vector<double>& continuous time coefficients,
+//					  highest power of s to lowest power of s
+//		denominator	= const std::vector<double>& continuous time coefficients,
+//					  highest power of s to lowest power of s
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, false if the design failed (in which case the direct-form
+//		coefficients should be used); true if sections were generated or if
+//		the direct-form coefficients are exact (constant gain or improper
+//		transfer function)
+//
+//=============================================================================
+bool Filter::GenerateSections(const std::vector<double> &numerator,
+	const std::vector<double> &denominator)
+{
+	sections.clear();
+
+	const std::vector<double> num(RemoveLeadingZeros(numerator));
+	const std::vector<double> den(RemoveLeadingZeros(denominator));
+	if (num.empty() || den.size() < 2 || num.size() > den.size())
+		return true;
+
+	RootSet zeros, poles;
+	if (!FindRoots(num, zeros) || !FindRoots(den, poles))
+		return false;
+
+	return GenerateSections(zeros, poles, num.front(), den.front());
+}
+
+//=============================================================================
+// Class:			Filter
+// Function:		GenerateSections
+//
+// Description:		Generates a cascade of second-order sections from the
+//					poles and zeros of a continuous-time (s-domain) transfer
+//					function.  The roots are mapped to the z-domain
+//					individually with the bilinear transform, which avoids
+//					expanding (and losing precision in) high-order
+//					polynomials.  Each pole pair is combined with the nearest
+//					remaining zero pair, and sections are ordered with the
+//					poles nearest to the unit circle last.
+//
+// Input Arguments:
+//		zeros				= const RootSet&
+//		poles				= const RootSet&
+//		numeratorLeading	= const double& coefficient of the highest power
+//							  of s in the numerator
+//		denominatorLeading	= const double& coefficient of the highest power
+//							  of s in the denominator
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool, false if the design failed (in which case the direct-form
+//		coefficients should be used); true if sections were generated or if
+//		the direct-form coefficients are exact
+//
+//=============================================================================
+bool Filter::GenerateSections(const RootSet& zeros, const RootSet& poles,
+	const double& numeratorLeading, const double& denominatorLeading)
+{
+	sections.clear();
+
+	const size_t zeroCount(GetDegree(zeros));
+	const size_t poleCount(GetDegree(poles));
+	if (poleCount == 0 || zeroCount > poleCount)
+		return true;
+
+	// Each s-domain factor (s - r) maps to (2 * fs - r) * (1 - q * z^-1) / (1 + z^-1)
+	// where q = (2 * fs + r) / (2 * fs - r), so the overall gain is the ratio of
+	// leading coefficients times the product of the (2 * fs - r) terms.  Work
+	// with logarithms to avoid overflow at high orders.
+	const double twoFs(2.0 * sampleRate);
+	double logGain(log(fabs(numeratorLeading)) - log(fabs(denominatorLeading)));
+	bool negativeGain((numeratorLeading < 0.0) != (denominatorLeading < 0.0));
+	for (const auto& r : zeros.real)
+	{
+		logGain += log(fabs(twoFs - r));
+		negativeGain ^= (twoFs - r < 0.0);
+	}
+	for (const auto& r : zeros.complex)
+		logGain += 2.0 * log(std::abs(twoFs - r));
+	for (const auto& r : poles.real)
+	{
+		logGain -= log(fabs(twoFs - r));
+		negativeGain ^= (twoFs - r < 0.0);
+	}
+	for (const auto& r : poles.complex)
+		logGain -= 2.0 * log(std::abs(twoFs - r));
+
+	if (!std::isfinite(logGain))
+		return false;
+
+	RootSet zZeros(MapToZDomain(zeros));
+	const RootSet zPoles(MapToZDomain(poles));
+
+	// Remaining (1 + z^-1) terms from the difference in order become zeros at z = -1
+	zZeros.real.insert(zZeros.real.end(), poleCount - zeroCount, -1.0);
+
+	for (const auto& r : zPoles.real)
+	{
+		if (!std::isfinite(r) || fabs(r) >= 1.0)
+			return false;
+	}
+	for (const auto& r : zPoles.complex)
+	{
+		if (!std::isfinite(r.real()) || !std::isfinite(r.imag()) || std::abs(r) >= 1.0)
+			return false;
+	}
+
+	std::vector<Quadratic> zeroFactors(GroupRoots(zZeros));
+	std::vector<Quadratic> poleFactors(GroupRoots(zPoles));
+	assert(zeroFactors.size() == poleFactors.size());
+
+	// Pair poles nearest the unit circle first, since they benefit most from nearby zeros
+	std::sort(poleFactors.begin(), poleFactors.end(), [](const Quadratic& a, const Quadratic& b)
+	{
+		return std::abs(a.location) > std::abs(b.location);
+	});
+
+	for (const auto& pole : poleFactors)
+	{
+		auto nearestZero(std::min_element(zeroFactors.begin(), zeroFactors.end(),
+			[&pole](const Quadratic& a, const Quadratic& b)
+		{
+			return std::abs(a.location - pole.location) < std::abs(b.location - pole.location);
+		}));
+
+		Section section;
+		section.b0 = 1.0;
+		section.b1 = nearestZero->c1;
+		section.b2 = nearestZero->c2;
+		section.a1 = pole.c1;
+		section.a2 = pole.c2;
+		section.s1 = 0.0;
+		section.s2 = 0.0;
+		sections.insert(sections.begin(), section);
+
+		zeroFactors.erase(nearestZero);
+	}
+
+	const double gain((negativeGain ? -1.0 : 1.0) * exp(logGain));
+	sections.front().b0 *= gain;
+	sections.front().b1 *= gain;
+	sections.front().b2 *= gain;
+
+	return true;
+}
+
+//=============================================================================
+// Class:			Filter
+// Function:		MapToZDomain
+//
+// Description:		Maps continuous-time (s-domain) roots to the discrete-time
+//					(z-domain) according to the bilinear transform.
+//
+// Input Arguments:
+//		roots	= const RootSet&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		RootSet
+//
+//=============================================================================
+Filter::RootSet Filter::MapToZDomain(const RootSet& roots) const
+{
+	const double twoFs(2.0 * sampleRate);
+	RootSet mapped;
+	for (const auto& r : roots.real)
+		mapped.real.push_back((twoFs + r) / (twoFs - r));
+	for (const auto& r : roots.complex)
+		mapped.complex.push_back((twoFs + r) / (twoFs - r));
+
+	return mapped;
+}
+
+//=============================================================================
+// Class:			Filter
+// Function:		FindRoots
+//
+// Description:		Finds the roots of the specified polynomial using the
+//					Aberth-Ehrlich method.  The polynomial is first scaled so
+//					its roots lie near the unit circle.  Iteration for each
+//					root stops once the residual is within the rounding error
+//					of evaluating the polynomial, which also handles repeated
+//					roots.
+//
+// Input Arguments:
+//		coefficients	= const std::vector<double>& ordered from highest
+//						  power to zero power, with non-zero leading term
+//
+// Output Arguments:
+//		roots			= RootSet&
+//
+// Return Value:
+//		bool, false if the iteration did not converge
+//
+//=============================================================================
+bool Filter::FindRoots(const std::vector<double>& coefficients, RootSet& roots)
+{
+	assert(!coefficients.empty() && coefficients.front() != 0.0);
+	roots.real.clear();
+	roots.complex.clear();
+
+	size_t degree(coefficients.size() - 1);
+	while (degree > 0 && coefficients[degree] == 0.0)
+	{
+		roots.real.push_back(0.0);
+		--degree;
+	}
+
+	if (degree == 0)
+		return true;
+
+	// Monic polynomial in t = s / scale
+	const double logScale((log(fabs(coefficients[degree])) - log(fabs(coefficients.front()))) / degree);
+	std::vector<double> p(degree + 1);
+	size_t i, j;
+	for (i = 0; i <= degree; ++i)
+	{
+		if (coefficients[i] == 0.0)
+			p[i] = 0.0;
+		else
+			p[i] = copysign(exp(log(fabs(coefficients[i])) - log(fabs(coefficients.front())) - i * logScale),
+				coefficients[i] * coefficients.front());
+	}
+
+	std::vector<Complex> t(degree);
+	const double pi(4.0 * atan(1.0));
+	for (i = 0; i < degree; ++i)
+		t[i] = std::polar(1.0, 2.0 * pi * i / degree + 0.4);
+
+	const double epsilon(std::numeric_limits<double>::epsilon());
+	std::vector<bool> done(degree, false);
+	std::vector<double> error(degree);// Estimated error in each root
+	const unsigned int maxIterations(1000);
+	unsigned int iteration;
+	size_t remaining(degree);
+	for (iteration = 0; iteration < maxIterations && remaining > 0; ++iteration)
+	{
+		for (i = 0; i < degree; ++i)
+		{
+			if (done[i])
+				continue;
+
+			Complex value(1.0), derivative(0.0);
+			double bound(1.0);// Bound on rounding error of the evaluation
+			const double magnitude(std::abs(t[i]));
+			for (j = 1; j <= degree; ++j)
+			{
+				derivative = derivative * t[i] + value;
+				value = value * t[i] + p[j];
+				bound = bound * magnitude + fabs(p[j]);
+			}
+
+			if (std::abs(value) <= 4.0 * degree * epsilon * bound)
+			{
+				error[i] = 4.0 * degree * epsilon * bound / std::abs(derivative);
+				done[i] = true;
+				--remaining;
+				continue;
+			}
+
+			const Complex ratio(value / derivative);
+			Complex sum(0.0);
+			for (j = 0; j < degree; ++j)
+			{
+				if (j != i)
+					sum += 1.0 / (t[i] - t[j]);
+			}
+
+			const Complex step(ratio / (1.0 - ratio * sum));
+			if (!std::isfinite(step.real()) || !std::isfinite(step.imag()))
+				return false;
+			t[i] -= step;
+		}
+	}
+
+	if (remaining > 0)
+		return false;
+
+	// Sort into real roots and conjugate pairs.  Rounding errors in the
+	// coefficients perturb the roots (especially within clusters) by more than
+	// the distance between them, so the roots are not exactly symmetric about
+	// the real axis:  roots within their estimated error of the real axis are
+	// taken to be real, and each remaining root is paired with the root
+	// nearest its conjugate, regardless of the sign of its imaginary part.
+	const double scale(exp(logScale));
+	const double realTolerance(1.0e-10);
+	std::vector<Complex> candidates;
+	for (i = 0; i < degree; ++i)
+	{
+		if (fabs(t[i].imag()) <= std::max(realTolerance * std::max(1.0, std::abs(t[i])), error[i]))
+			roots.real.push_back(t[i].real() * scale);
+		else
+			candidates.push_back(t[i]);
+	}
+
+	// Roots furthest from the real axis are paired first, since their partners are the least ambiguous
+	std::sort(candidates.begin(), candidates.end(), [](const Complex& a, const Complex& b)
+	{
+		return fabs(a.imag()) > fabs(b.imag());
+	});
+
+	auto r(candidates.begin());
+	while (candidates.end() - r > 1)
+	{
+		auto partner(std::min_element(r + 1, candidates.end(), [&r](const Complex& a, const Complex& b)
+		{
+			return std::abs(std::conj(a) - *r) < std::abs(std::conj(b) - *r);
+		}));
+
+		const Complex average(0.5 * (*r + std::conj(*partner)));
+		roots.complex.push_back(Complex(average.real(), fabs(average.imag())) * scale);
+		std::iter_swap(r + 1, partner);
+		r += 2;
+	}
+
+	// With real coefficients, an unpaired root can only be a perturbed real root
+	if (r != candidates.end())
+		roots.real.push_back(r->real() * scale);
+
+	return true;
+}
+
+//=============================================================================
+// Class:			Filter
+// Function:		GroupRoots
+//
+// Description:		Combines roots into first- and second-order factors with
+//					real coefficients.  Each complex conjugate pair forms one
+//					factor, and real roots are combined in order of value.  At
+//					most one first-order factor results.
+//
+// Input Arguments:
+//		roots	= RootSet
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<Quadratic>
+//
+//=============================================================================
+std::vector<Filter::Quadratic> Filter::GroupRoots(RootSet roots)
+{
+	std::vector<Quadratic> factors;
+	for (const auto& r : roots.complex)
+	{
+		Quadratic q;
+		q.c1 = -2.0 * r.real();
+		q.c2 = std::norm(r);
+		q.location = r;
+		factors.push_back(q);
+	}
+
+	std::sort(roots.real.begin(), roots.real.end());
+	size_t i;
+	for (i = 0; i < roots.real.size(); i += 2)
+	{
+		Quadratic q;
+		if (i + 1 < roots.real.size())
+		{
+			q.c1 = -(roots.real[i] + roots.real[i + 1]);
+			q.c2 = roots.real[i] * roots.real[i + 1];
+			q.location = fabs(roots.real[i]) > fabs(roots.real[i + 1]) ? roots.real[i] : roots.real[i + 1];
+		}
+		else
+		{
+			q.c1 = -roots.real[i];
+			q.c2 = 0.0;
+			q.location = roots.real[i];
+		}
+		factors.push_back(q);
+	}
+
+	return factors;
+}
+
+//=============================================================================
+// Class:			Filter
+// Function:		SortRoots
+//
+// Description:		Sorts roots into real roots and complex conjugate pairs.
+//					Only the root with positive imaginary part is kept from
+//					each pair.
+//
+// Input Arguments:
+//		roots	= const std::vector<Complex>& in which complex roots are
+//				  accompanied by their conjugates
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		RootSet
+//
+//=============================================================================
+Filter::RootSet Filter::SortRoots(const std::vector<Complex>& roots)
+{
+	const double realTolerance(1.0e-10);
+	RootSet sorted;
+	size_t lowerCount(0);
+	for (const auto& r : roots)
+	{
+		if (fabs(r.imag()) <= realTolerance * std::abs(r))
+			sorted.real.push_back(r.real());
+		else if (r.imag() > 0.0)
+			sorted.complex.push_back(r);
+		else
+			++lowerCount;
+	}
+
+	assert(lowerCount == sorted.complex.size());
+	(void)lowerCount;
+	return sorted;
+}
+
+//=============================================================================
+// Class:			Filter
+// Function:		ExpandRoots
+//
+// Description:		Computes the coefficients of the polynomial with the
+//					specified roots.
+//
+// Input Arguments:
+//		roots	= const RootSet&
+//		leading	= const double& coefficient of the highest power
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<double> ordered from highest power to zero power
+//
+//=============================================================================
+std::vector<double> Filter::ExpandRoots(const RootSet& roots, const double& leading)
+{
+	std::vector<double> coefficients(1, leading);
+	for (const auto& r : roots.real)
+		coefficients = MultiplyPolynomials(coefficients, { 1.0, -r });
+	for (const auto& r : roots.complex)
+		coefficients = MultiplyPolynomials(coefficients, { 1.0, -2.0 * r.real(), std::norm(r) });
+
+	return coefficients;
+}
+
+//=============================================================================
+// Class:			Filter
+// Function:		RemoveLeadingZeros
+//
+// Description:		Removes zero coefficients of the highest powers.
+//
+// Input Arguments:
+//		coefficients	= std::vector<double>
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<double>
+//
+//=============================================================================
+std::vector<double> Filter::RemoveLeadingZeros(std::vector<double> coefficients)
+{
+	const auto firstNonZero(std::find_if(coefficients.begin(), coefficients.end(), [](const double& c)
+	{
+		return c != 0.0;
+	}));
+	coefficients.erase(coefficients.begin(), firstNonZero);
+	return coefficients;
+}
+
+//=============================================================================
+// Class:			Filter
+// Function:		BilinearTransform
+//
+// Description:		Computes the discrete-time (z-domain) polynomial
+//					equivalent to the specified continuous-time (s-domain)
+//					polynomial.  Substituting s = 2 * (1 - z^-1) / (T * (1 + z^-1))
+//					and multiplying through by (T * (1 + z^-1))^highestPower
+//					gives the sum of c[p] * A^p * B^(highestPower - p), where
+//					A = 2 * (1 - z^-1) and B = T * (1 + z^-1).  This is
+//					evaluated with Horner's method.
 //
 // Input Arguments:
 //		coefficients	= const std::vector<double>& continuous time coefficients,
@@ -162,46 +790,60 @@ void Filter::GenerateCoefficients(const std::vector<double> &numerator,
 //		None
 //
 // Return Value:
-//		std::string
+//		std::vector<double> containing coefficients from z^0 to z^-highestPower
 //
 //=============================================================================
-std::string Filter::AssembleZExpression(
+std::vector<double> Filter::BilinearTransform(
 	const std::vector<double>& coefficients,
 	const unsigned int &highestPower) const
 {
-	std::ostringstream ss;
-	ss << "(" << std::fixed << 1.0 / sampleRate << "*(1+z^-1))";
-	std::string posBilinTerm(ss.str()), negBilinTerm("(2*(1-z^-1))");
-	std::string result;
+	assert(!coefficients.empty() && coefficients.size() <= highestPower + 1);
+	const std::vector<double> a({2.0, -2.0});
+	const std::vector<double> b({1.0 / sampleRate, 1.0 / sampleRate});
 
-	unsigned int i;
-	for (i = 0; i < coefficients.size(); ++i)
+	std::vector<double> result(1, coefficients.front());
+	std::vector<double> bPower(1, 1.0);
+	unsigned int i, j;
+	for (i = 1; i < coefficients.size(); ++i)
 	{
-		if (IsZero(coefficients[i]))
-			continue;
+		bPower = MultiplyPolynomials(bPower, b);
+		result = MultiplyPolynomials(result, a);
+		for (j = 0; j < result.size(); ++j)
+			result[j] += coefficients[i] * bPower[j];
+	}
 
-		std::ostringstream term;
-		term << std::fixed << coefficients[i];
-		if (!result.empty() && coefficients[i] > 0.0)
-			result.append("+");
-		result.append(term.str());
+	for (i = coefficients.size() - 1; i < highestPower; ++i)
+		result = MultiplyPolynomials(result, b);
 
-		if (coefficients.size() - 1 > i)
-			result.append("*" + negBilinTerm);
-		if (coefficients.size() - 1 > 1 + i)
-		{
-			std::ostringstream power;
-			power << "^" << coefficients.size() - i - 1;
-			result.append(power.str());
-		}
-		if (highestPower + i > coefficients.size() - 1)
-			result.append("*" + posBilinTerm);
-		if (highestPower + i > coefficients.size())
-		{
-			std::ostringstream power;
-			power << "^" << highestPower - coefficients.size() + 1 + i;
-			result.append(power.str());
-		}
+	return result;
+}
+
+//=============================================================================
+// Class:			Filter
+// Function:		MultiplyPolynomials
+//
+// Description:		Multiplies two polynomials.
+//
+// Input Arguments:
+//		a	= const std::vector<double>&
+//		b	= const std::vector<double>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<double>
+//
+//=============================================================================
+std::vector<double> Filter::MultiplyPolynomials(const std::vector<double>& a,
+	const std::vector<double>& b)
+{
+	std::vector<double> result(a.size() + b.size() - 1, 0.0);
+	unsigned int i, j;
+	for (i = 0; i < a.size(); ++i)
+	{
+		for (j = 0; j < b.size(); ++j)
+			result[i + j] += a[i] * b[j];
 	}
 
 	return result;
@@ -225,12 +867,27 @@ std::string Filter::AssembleZExpression(
 //=============================================================================
 void Filter::Initialize(const double &initialValue)
 {
+	// Each section is initialized to its steady-state response to the output of the previous section
+	double input(initialValue);
+	for (auto& section : sections)
+	{
+		const double denominatorSum(1.0 + section.a1 + section.a2);
+		const double output(IsZero(denominatorSum) ? 0.0 :
+			input * (section.b0 + section.b1 + section.b2) / denominatorSum);
+		section.s2 = section.b2 * input - section.a2 * output;
+		section.s1 = section.b1 * input - section.a1 * output + section.s2;
+		input = output;
+	}
+
 	for (auto& v : mU)
 		v = initialValue;
 
 	double ssGain(ComputeSteadyStateGain());
 	for (auto& v : mY)
 		v = initialValue * ssGain;
+
+	uPosition = 0;
+	yPosition = 0;
 }
 
 //=============================================================================
@@ -251,50 +908,273 @@ void Filter::Initialize(const double &initialValue)
 //=============================================================================
 double Filter::Apply(const double &u0)
 {
-	ShiftArray(mU);
-	mU[0] = u0;
+	if (!sections.empty())
+	{
+		double y(u0);
+		for (auto& section : sections)
+		{
+			const double x(y);
+			y = section.b0 * x + section.s1;
+			section.s1 = section.b1 * x - section.a1 * y + section.s2;
+			section.s2 = section.b2 * x - section.a2 * y;
+		}
+
+		mU[uPosition] = u0;
+		mY[yPosition] = y;
+		return y;
+	}
+
+	// Most recent values are at the positions, next most recent follow
+	const size_t inSize(mU.size() / 2), outSize(mY.size() / 2);
+	uPosition = (uPosition == 0 ? inSize : uPosition) - 1;
+	yPosition = (yPosition == 0 ? outSize : yPosition) - 1;
+	mU[uPosition] = u0;
+	mU[uPosition + inSize] = u0;
 
-	ShiftArray(mY);
+	const double* uHistory(mU.data() + uPosition);
+	const double* yHistory(mY.data() + yPosition);
 
-	mY[0] = 0.0;
+	double y0(0.0);
 	unsigned int i;
-	for (i = 0; i < mA.size(); ++i)
-		mY[0] += mA[i] * mU[i];
-	for (i = 1; i < mY.size(); ++i)
-		mY[0] -= mB[i - 1] * mY[i];
+	for (i = 0; i < inSize; ++i)
+		y0 += mA[i] * uHistory[i];
+	for (i = 1; i < outSize; ++i)
+		y0 -= mB[i - 1] * yHistory[i];
 
-	return mY[0];
+	mY[yPosition] = y0;
+	mY[yPosition + outSize] = y0;
+	return y0;
 }
 
 //=============================================================================
 // Class:			Filter
-// Function:		ShiftArray
+// Function:		Process
 //
-// Description:		Shifts the array values by one index (value with highest
-//					index is lost).
+// Description:		Applies the filter to a block of data.  Filters are
+//					normally implemented as second-order sections; the
+//					direct form is used only when sections are not
+//					available.
 //
 // Input Arguments:
-//		s		= std::vector<double>&
+//		input	= const float*
+//		count	= const size_t&
 //
 // Output Arguments:
+//		output	= float*
+//
+// Return Value:
 //		None
 //
+//=============================================================================
+void Filter::Process(const float* input, float* output, const size_t& count)
+{
+	if (count == 0)
+		return;
+
+	if (mU.empty())
+	{
+		if (input != output)
+			std::copy(input, input + count, output);
+		return;
+	}
+
+	if (!sections.empty())
+	{
+		ProcessSections(input, output, count);
+		return;
+	}
+
+	ProcessDirectForm(input, output, count);
+}
+
+//=============================================================================
+// Class:			Filter
+// Function:		ProcessSections
+//
+// Description:		Applies the cascade of second-order sections to a block
+//					of data.  Data is converted to double precision one
+//					sub-block at a time (in a buffer on the stack, so nothing
+//					is allocated), and each sub-block is passed through
+//					groups of sections whose coefficients and state are held
+//					in local variables.  Each section performs the same
+//					operations as in Apply(), so the results are identical.
+//
+// Input Arguments:
+//		input	= const float*
+//		count	= const size_t&
+//
+// Output Arguments:
+//		output	= float*
+//
 // Return Value:
 //		None
 //
 //=============================================================================
-void Filter::ShiftArray(std::vector<double>& s) const
+void Filter::ProcessSections(const float* input, float* output, const size_t& count)
 {
-	unsigned int i;
-	for (i = s.size() - 1; i > 0; --i)
-		s[i] = s[i - 1];
+	const double lastInput(input[count - 1]);// Before it is (potentially) overwritten
+
+	const size_t blockSize(256);
+	double block[blockSize];
+	size_t start, i, j;
+	for (start = 0; start < count; start += blockSize)
+	{
+		const size_t blockCount(std::min(blockSize, count - start));
+		for (i = 0; i < blockCount; ++i)
+			block[i] = input[start + i];
+
+		static_assert(maxSectionGroupSize == 4, "Cases below must cover every group size");
+		for (j = 0; j < sections.size(); j += maxSectionGroupSize)
+		{
+			switch (std::min(sections.size() - j, maxSectionGroupSize))
+			{
+			case 1:
+				ProcessSectionGroup<1>(sections.data() + j, block, blockCount);
+				break;
+
+			case 2:
+				ProcessSectionGroup<2>(sections.data() + j, block, blockCount);
+				break;
+
+			case 3:
+				ProcessSectionGroup<3>(sections.data() + j, block, blockCount);
+				break;
+
+			default:
+				ProcessSectionGroup<maxSectionGroupSize>(sections.data() + j, block, blockCount);
+			}
+		}
+
+		for (i = 0; i < blockCount; ++i)
+			output[start + i] = static_cast<float>(block[i]);
+	}
+
+	mU[uPosition] = lastInput;
+	mY[yPosition] = block[(count - 1) % blockSize];
+}
+
+//=============================================================================
+// Class:			Filter
+// Function:		ProcessSectionGroup (static)
+//
+// Description:		Applies N consecutive sections to a block of data in
+//					place.  Because N is known at compile time, the
+//					coefficients and state are copied into local arrays which
+//					the compiler can keep in registers (a local copy also
+//					keeps the compiler from assuming the data aliases the
+//					state).  The state is written back at the end.
+//
+// Input Arguments:
+//		group	= Section* pointing to the first of N sections
+//		data	= double*
+//		count	= const size_t&
+//
+// Output Arguments:
+//		data	= double*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <size_t N>
+void Filter::ProcessSectionGroup(Section* group, double* data, const size_t& count)
+{
+	double b0[N], b1[N], b2[N], a1[N], a2[N], s1[N], s2[N];
+	size_t i, j;
+	for (j = 0; j < N; ++j)
+	{
+		b0[j] = group[j].b0;
+		b1[j] = group[j].b1;
+		b2[j] = group[j].b2;
+		a1[j] = group[j].a1;
+		a2[j] = group[j].a2;
+		s1[j] = group[j].s1;
+		s2[j] = group[j].s2;
+	}
+
+	for (i = 0; i < count; ++i)
+	{
+		double y(data[i]);
+		for (j = 0; j < N; ++j)
+		{
+			const double x(y);
+			y = b0[j] * x + s1[j];
+			s1[j] = b1[j] * x - a1[j] * y + s2[j];
+			s2[j] = b2[j] * x - a2[j] * y;
+		}
+		data[i] = y;
+	}
+
+	for (j = 0; j < N; ++j)
+	{
+		group[j].s1 = s1[j];
+		group[j].s2 = s2[j];
+	}
+}
+
+//=============================================================================
+// Class:			Filter
+// Function:		ProcessDirectForm
+//
+// Description:		Applies the direct-form filter to a block of data.  The
+//					input and output histories are the member ring buffers,
+//					so no per-sample shifting is required and nothing is
+//					allocated or copied.  Terms are accumulated in the same
+//					order as in Apply(), so the results are identical.
+//
+// Input Arguments:
+//		input	= const float*
+//		count	= const size_t&
+//
+// Output Arguments:
+//		output	= float*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void Filter::ProcessDirectForm(const float* input, float* output, const size_t& count)
+{
+	const size_t inSize(mU.size() / 2), outSize(mY.size() / 2);
+	double* u(mU.data());
+	double* y(mY.data());
+	const double* a(mA.data());
+	const double* b(mB.data());
+
+	// Local copies keep the compiler from assuming the outputs alias the positions
+	size_t uLocal(uPosition), yLocal(yPosition);
+	size_t i, j;
+	for (i = 0; i < count; ++i)
+	{
+		uLocal = (uLocal == 0 ? inSize : uLocal) - 1;
+		yLocal = (yLocal == 0 ? outSize : yLocal) - 1;
+		u[uLocal] = input[i];
+		u[uLocal + inSize] = input[i];
+
+		const double* uHistory(u + uLocal);
+		const double* yHistory(y + yLocal);
+
+		double y0(0.0);
+		for (j = 0; j < inSize; ++j)
+			y0 += a[j] * uHistory[j];
+		for (j = 1; j < outSize; ++j)
+			y0 -= b[j - 1] * yHistory[j];
+
+		y[yLocal] = y0;
+		y[yLocal + outSize] = y0;
+		output[i] = static_cast<float>(y0);
+	}
+
+	uPosition = uLocal;
+	yPosition = yLocal;
 }
 
 //=============================================================================
 // Class:			Filter
 // Function:		ResizeArrays
 //
-// Description:		Allocates the coefficient and input/output storage arrays.
+// Description:		Allocates the coefficient and input/output storage arrays
+//					(the input/output ring buffers hold each value twice).
 //
 // Input Arguments:
 //		_inSize		= const unsigned int&
@@ -312,8 +1192,10 @@ void Filter::ResizeArrays(const unsigned int &inSize,
 {
 	mA.resize(inSize);
 	mB.resize(outSize - 1);
-	mU.resize(inSize);
-	mY.resize(outSize);
+	mU.resize(2 * inSize);
+	mY.resize(2 * outSize);
+	uPosition = 0;
+	yPosition = 0;
 }
 
 //=============================================================================
@@ -525,6 +1407,20 @@ double Filter::ComputeSteadyStateGain(const std::string &num,
 //=============================================================================
 double Filter::ComputeSteadyStateGain() const
 {
+	if (!sections.empty())
+	{
+		double gain(1.0);
+		for (const auto& section : sections)
+		{
+			const double denominatorSum(1.0 + section.a1 + section.a2);
+			if (IsZero(denominatorSum))
+				return 0.0;
+			gain *= (section.b0 + section.b1 + section.b2) / denominatorSum;
+		}
+
+		return gain;
+	}
+
 	double numeratorSum(0.0);
 	double denominatorSum(1.0);
 	for (const auto& v : mA)
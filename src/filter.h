@@ -9,8 +9,13 @@
 // Standard C++ headers
 #include <vector>
 #include <string>
+#include <complex>
 
 /// Class for applying an arbitrary digital filter (transfer function) to data.
+/// When possible, the filter is implemented as a cascade of second-order
+/// sections built from the poles and zeros of the transfer function, which
+/// remains accurate at high orders.  Otherwise, the direct-form coefficients
+/// are used.
 class Filter
 {
 public:
@@ -38,6 +43,38 @@ public:
 		const std::vector<double> &denominator,
 		const double &initialValue = 0.0);
 
+	/// Constructor for a continuous-time transfer function specified by its
+	/// poles and zeros.  Finding the roots of high-order polynomials is
+	/// poorly conditioned, so this should be preferred when the roots are
+	/// known.
+	///
+	/// \param sampleRate   Frequency at which the digital filter is sampled.
+	/// \param zeros        Zeros of the continuous-time (s-domain) transfer
+	///                     function.  Complex zeros must be accompanied by
+	///                     their conjugates.
+	/// \param poles        Poles of the continuous-time transfer function.
+	///                     Complex poles must be accompanied by their
+	///                     conjugates.
+	/// \param gain         Ratio of the highest-power coefficients of the
+	///                     numerator and denominator.
+	/// \param initialValue Initial value of filter input.
+	Filter(const double &sampleRate, const std::vector<std::complex<double>> &zeros,
+		const std::vector<std::complex<double>> &poles, const double &gain,
+		const double &initialValue = 0.0);
+
+	/// Creates a finite impulse response (FIR) filter.
+	///
+	/// \param sampleRate      Frequency at which the digital filter is
+	///                        sampled.
+	/// \param impulseResponse Discrete-time filter coefficients (the
+	///                        coefficient applied to the current input is
+	///                        first).
+	/// \param initialValue    Initial value of filter input.
+	///
+	/// \returns The FIR filter.
+	static Filter FromImpulseResponse(const double &sampleRate,
+		const std::vector<double> &impulseResponse, const double &initialValue = 0.0);
+
 	/// Initializes the filter to the specified value.
 	///
 	/// \param initialValue Initial value of filter input.
@@ -50,13 +87,23 @@ public:
 	/// \returns The filtered value computed after considering \p u0.
 	double Apply(const double &u0);
 
-	/// Gets the last value passed to Apply().
+	/// Applies the filter to a block of data.  The result is the same as
+	/// calling Apply() for each sample, and no memory is allocated, so the
+	/// data may be processed in blocks of any size.
+	///
+	/// \param input  Data to filter.
+	/// \param output Location to store the filtered data.  May be the same as
+	///               \p input.
+	/// \param count  Number of samples in \p input and \p output.
+	void Process(const float* input, float* output, const size_t& count);
+
+	/// Gets the last value passed to Apply() or Process().
 	/// \returns The last input value to the filter.
-	double GetRawValue() const { return mU[0]; }
+	double GetRawValue() const { return mU[uPosition]; }
 
-	/// Gets the last value output from Apply().
+	/// Gets the last value output from Apply() or Process().
 	/// \returns the last output value of the filter.
-	double GetFilteredValue() const { return mY[0]; }
+	double GetFilteredValue() const { return mY[yPosition]; }
 
 	/// Extracts sorted numeric polynomial coefficients from the specified
 	/// string.  Coefficients are ordered from highest power to zero power.
@@ -84,6 +131,39 @@ public:
 	/// \returns the steady-state gain for this filter.
 	double ComputeSteadyStateGain() const;
 
+	/// Estimates the number of samples required for the response to an
+	/// arbitrary initial state to decay to the specified fraction of its
+	/// initial magnitude.  Estimates are available only for FIR filters
+	/// (for which the estimate is exact) and filters implemented as cascades
+	/// of stable second-order sections.
+	///
+	/// \param tolerance Remaining fraction of the initial response.
+	/// \param length    Number of samples.
+	///
+	/// \returns True if the estimate is available.
+	bool GetSettlingLength(const double& tolerance, size_t& length) const;
+
+	/// Indicates whether or not the filter is implemented as a cascade of
+	/// second-order sections.
+	/// \returns True if second-order sections are used.
+	bool UsesSections() const { return !sections.empty(); }
+
+	/// Indicates whether or not the poles and zeros of the transfer function
+	/// could not be found or mapped to stable second-order sections.  In this
+	/// case the direct-form coefficients are used, which may be inaccurate or
+	/// unstable.
+	/// \returns True if the second-order section design failed.
+	bool SectionDesignFailed() const { return sectionDesignFailed; }
+
+	/// Indicates whether or not the filter has a finite impulse response
+	/// (i.e. the output does not depend on previous outputs).
+	/// \returns True if the filter is an FIR filter.
+	bool IsFiniteImpulseResponse() const { return sections.empty() && mB.empty(); }
+
+	/// Gets the impulse response of an FIR filter.
+	/// \returns The discrete-time filter coefficients.
+	const std::vector<double>& GetImpulseResponse() const { return mA; }
+
 	Filter& operator=(const Filter& f);
 	Filter& operator=(Filter&& f);
 
@@ -91,18 +171,70 @@ private:
 	// Filter coefficients
 	std::vector<double> mA;
 	std::vector<double> mB;
+
+	// Input and output histories, stored as ring buffers whose contents are
+	// repeated so that the history starting at the most recent value (at
+	// the position) is always contiguous
 	std::vector<double> mY;
 	std::vector<double> mU;
+	size_t yPosition = 0;
+	size_t uPosition = 0;
 
 	double sampleRate;// [Hz]
 
+	// Second-order section, implemented in transposed direct form II
+	struct Section
+	{
+		double b0, b1, b2;// Numerator
+		double a1, a2;// Denominator (a0 = 1)
+		double s1, s2;// State
+	};
+	std::vector<Section> sections;// Empty when using direct-form coefficients
+	bool sectionDesignFailed = false;
+
+	typedef std::complex<double> Complex;
+
+	// Real roots and complex conjugate pairs (only the root with positive
+	// imaginary part is stored) of a polynomial with real coefficients
+	struct RootSet
+	{
+		std::vector<double> real;
+		std::vector<Complex> complex;
+	};
+
+	// Factor of the form 1 + c1 * z^-1 + c2 * z^-2
+	struct Quadratic
+	{
+		double c1, c2;
+		Complex location;// Root closest to the unit circle (used for pairing poles and zeros)
+	};
+
+	bool GenerateSections(const std::vector<double> &numerator,
+		const std::vector<double> &denominator);
+	bool GenerateSections(const RootSet& zeros, const RootSet& poles,
+		const double& numeratorLeading, const double& denominatorLeading);
+	RootSet MapToZDomain(const RootSet& roots) const;
+	static bool FindRoots(const std::vector<double>& coefficients, RootSet& roots);
+	static std::vector<Quadratic> GroupRoots(RootSet roots);
+	static RootSet SortRoots(const std::vector<Complex>& roots);
+	static std::vector<double> ExpandRoots(const RootSet& roots, const double& leading);
+	static size_t GetDegree(const RootSet& roots) { return roots.real.size() + 2 * roots.complex.size(); }
+	static std::vector<double> RemoveLeadingZeros(std::vector<double> coefficients);
+
+	void ProcessSections(const float* input, float* output, const size_t& count);
+	static const size_t maxSectionGroupSize = 4;
+	template <size_t N>
+	static void ProcessSectionGroup(Section* group, double* data, const size_t& count);
+	void ProcessDirectForm(const float* input, float* output, const size_t& count);
+
 	void ResizeArrays(const unsigned int &inSize, const unsigned int &outSize);
-	void ShiftArray(std::vector<double>& s) const;
 
 	void GenerateCoefficients(const std::vector<double> &numerator,
 		const std::vector<double> &denominator);
-	std::string AssembleZExpression(const std::vector<double>& coefficients,
+	std::vector<double> BilinearTransform(const std::vector<double>& coefficients,
 		const unsigned int &highestPower) const;
+	static std::vector<double> MultiplyPolynomials(const std::vector<double>& a,
+		const std::vector<double>& b);
 	static std::vector<std::pair<int, double>> CollectLikeTerms(
 		std::vector<std::pair<int, double>> terms);
 	static std::vector<std::pair<int, double>> PadMissingTerms(
@@ -0,0 +1,386 @@
+// File:  filterChain.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Series of filters applied to sound data in a single pass.
+
+// Local headers
+#include "filterChain.h"
+#include "threadPool.h"
+#include "fastConvolution.h"
+
+// Standard C++ headers
+#include <algorithm>
+#include <iterator>
+#include <cassert>
+#include <memory>
+
+// Small enough that a block remains in L1 cache while it passes through every filter
+const size_t FilterChain::blockSize(4096);
+
+// Signals shorter than two chunks are filtered serially
+const size_t FilterChain::minimumChunkLength(1 << 20);
+
+// Remaining effect of the unknown initial state at the start of each chunk, relative to the signal
+const double FilterChain::settlingTolerance(1.0e-10);
+
+// Shorter FIR filters are applied directly
+const size_t FilterChain::minimumFastConvolutionLength(64);
+
+FilterChain::FilterChain(const std::vector<Filter>& filters,
+	const std::vector<bool>& zeroPhase) : filters(filters), zeroPhase(zeroPhase)
+{
+	assert(zeroPhase.empty() || zeroPhase.size() == filters.size());
+}
+
+//=============================================================================
+// Class:			FilterChain
+// Function:		Process
+//
+// Description:		Filters the specified samples.
+//
+// Input Arguments:
+//		input	= const DatasetType*
+//		count	= const size_t&
+//
+// Output Arguments:
+//		output	= DatasetType*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FilterChain::Process(const DatasetType* input, DatasetType* output, const size_t& count)
+{
+	if (count == 0)
+		return;
+
+	if (filters.empty())
+	{
+		if (input != output)
+			std::copy(input, input + count, output);
+		return;
+	}
+
+	const DatasetType* source(input);
+	for (auto& pass : GetPasses())
+	{
+		ProcessPass(pass, source, output, count);
+		source = output;
+	}
+}
+
+//=============================================================================
+// Class:			FilterChain
+// Function:		GetPasses
+//
+// Description:		Groups the filters into passes.  Consecutive forward
+//					passes are combined, so the chain requires one pass more
+//					than the number of zero-phase filters (or fewer, if the
+//					chain ends with a zero-phase filter).  Filters applied
+//					using fast convolution always have passes of their own.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<Pass>
+//
+//=============================================================================
+std::vector<FilterChain::Pass> FilterChain::GetPasses() const
+{
+	std::vector<Pass> passes;
+	size_t i;
+	for (i = 0; i < filters.size(); ++i)
+	{
+		const bool fastConvolution(UseFastConvolution(filters[i]));
+		if (passes.empty() || passes.back().reverse || passes.back().fastConvolution || fastConvolution)
+			passes.push_back(Pass());
+		passes.back().filters.push_back(filters[i]);
+		passes.back().fastConvolution = fastConvolution;
+
+		if (!zeroPhase.empty() && zeroPhase[i])
+		{
+			passes.push_back(Pass());
+			passes.back().filters.push_back(filters[i]);
+			passes.back().reverse = true;
+			passes.back().fastConvolution = fastConvolution;
+		}
+	}
+
+	return passes;
+}
+
+//=============================================================================
+// Class:			FilterChain
+// Function:		UseFastConvolution (static)
+//
+// Description:		Determines whether or not the specified filter should be
+//					applied using fast convolution.
+//
+// Input Arguments:
+//		filter	= const Filter&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//=============================================================================
+bool FilterChain::UseFastConvolution(const Filter& filter)
+{
+	return filter.IsFiniteImpulseResponse() &&
+		filter.GetImpulseResponse().size() >= minimumFastConvolutionLength;
+}
+
+//=============================================================================
+// Class:			FilterChain
+// Function:		ProcessPass
+//
+// Description:		Filters the specified samples in one direction, in
+//					parallel if the signal is long enough to be divided into
+//					chunks of at least minimumChunkLength samples (and sixteen
+//					times the settling length, to limit the overhead of the
+//					overlap).
+//
+// Input Arguments:
+//		pass	= Pass&
+//		input	= const DatasetType*
+//		count	= const size_t&
+//
+// Output Arguments:
+//		output	= DatasetType*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FilterChain::ProcessPass(Pass& pass, const DatasetType* input, DatasetType* output, const size_t& count)
+{
+	std::unique_ptr<FastConvolution> convolution;
+	if (pass.fastConvolution)
+		convolution = std::make_unique<FastConvolution>(pass.filters.front().GetImpulseResponse());
+
+	size_t settlingLength;
+	unsigned int chunkCount(0);
+	if (GetSettlingLength(pass.filters, settlingLength) && settlingLength <= count / 16)
+		chunkCount = static_cast<unsigned int>(count / std::max(minimumChunkLength, 16 * settlingLength));
+
+	if (chunkCount < 2)
+	{
+		std::vector<DatasetType> noWarmUp;
+		ProcessRange(pass.filters, convolution.get(), pass.reverse, input, output, count, noWarmUp);
+		return;
+	}
+
+	// When filtering in place, the samples adjacent to each chunk are
+	// overwritten by the neighboring chunk, so they are copied before any
+	// filtering begins.  Samples are stored in the order in which they are
+	// filtered.
+	std::vector<std::vector<DatasetType>> warmUpInputs(chunkCount);
+	const bool reverse(pass.reverse);
+	ThreadPool& pool(ThreadPool::GetShared());
+	pool.ParallelFor(count, chunkCount, [input, count, reverse, settlingLength, &warmUpInputs](const unsigned int& chunk, const size_t& begin, const size_t& end)
+	{
+		if (reverse)
+			warmUpInputs[chunk].assign(std::make_reverse_iterator(input + std::min(end + settlingLength, count)),
+				std::make_reverse_iterator(input + end));
+		else
+			warmUpInputs[chunk].assign(input + begin - std::min(begin, settlingLength), input + begin);
+	});
+
+	const std::vector<Filter>& filters(pass.filters);
+	const FastConvolution* sharedConvolution(convolution.get());
+	pool.ParallelFor(count, chunkCount, [&filters, sharedConvolution, reverse, input, output, &warmUpInputs](const unsigned int& chunk, const size_t& begin, const size_t& end)
+	{
+		std::vector<Filter> chunkFilters(filters);
+		ProcessRange(chunkFilters, sharedConvolution, reverse, input + begin, output + begin, end - begin, warmUpInputs[chunk]);
+	});
+}
+
+//=============================================================================
+// Class:			FilterChain
+// Function:		ProcessRange
+//
+// Description:		Filters a contiguous range of samples in one direction.
+//					If warm-up samples are provided, the filters are first
+//					initialized and run over those samples, so the result is
+//					(nearly) the same as if the preceding samples had been
+//					filtered.  Otherwise, the filters are initialized with
+//					the first value of the range.  For fast convolution, the
+//					warm-up samples are used directly as the input history,
+//					and the backward direction is handled by reversing the
+//					range in place.
+//
+// Input Arguments:
+//		filters		= std::vector<Filter>&
+//		convolution	= const FastConvolution*, nullptr unless the filters
+//					  are applied using fast convolution
+//		reverse		= const bool&
+//		input		= const DatasetType*
+//		count		= const size_t&
+//		warmUp		= std::vector<DatasetType>&, in the order in which they
+//					  are filtered (overwritten)
+//
+// Output Arguments:
+//		output		= DatasetType*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FilterChain::ProcessRange(std::vector<Filter>& filters, const FastConvolution* convolution,
+	const bool& reverse, const DatasetType* input, DatasetType* output, const size_t& count,
+	std::vector<DatasetType>& warmUp)
+{
+	if (convolution)
+	{
+		if (!reverse)
+		{
+			convolution->Process(input, output, count, warmUp.data(), warmUp.size());
+			return;
+		}
+
+		if (input == output)
+			std::reverse(output, output + count);
+		else
+			std::reverse_copy(input, input + count, output);
+
+		convolution->Process(output, output, count, warmUp.data(), warmUp.size());
+		std::reverse(output, output + count);
+		return;
+	}
+
+	if (!warmUp.empty())
+		ProcessSerial(filters, warmUp.data(), warmUp.data(), warmUp.size(), true);
+
+	if (reverse)
+		ProcessSerialReverse(filters, input, output, count, warmUp.empty());
+	else
+		ProcessSerial(filters, input, output, count, warmUp.empty());
+}
+
+//=============================================================================
+// Class:			FilterChain
+// Function:		ProcessSerial
+//
+// Description:		Passes the input through each filter, one block at a
+//					time.  The first filter reads from the input buffer and
+//					subsequent filters operate on the output buffer in place.
+//
+// Input Arguments:
+//		filters		= std::vector<Filter>&
+//		input		= const DatasetType*
+//		count		= const size_t&
+//		initialize	= const bool&, true to initialize each filter with the
+//					  first value of its input, false to continue from the
+//					  filters' current states
+//
+// Output Arguments:
+//		output		= DatasetType*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FilterChain::ProcessSerial(std::vector<Filter>& filters, const DatasetType* input,
+	DatasetType* output, const size_t& count, const bool& initialize)
+{
+	size_t blockStart;
+	for (blockStart = 0; blockStart < count; blockStart += blockSize)
+	{
+		const size_t blockEnd(std::min(blockStart + blockSize, count));
+		const DatasetType* source(input);
+		for (auto& f : filters)
+		{
+			// Initial value is the first sample seen by this particular filter
+			if (initialize && blockStart == 0)
+				f.Initialize(source[0]);
+
+			f.Process(source + blockStart, output + blockStart, blockEnd - blockStart);
+			source = output;
+		}
+	}
+}
+
+//=============================================================================
+// Class:			FilterChain
+// Function:		ProcessSerialReverse
+//
+// Description:		Passes the input through each filter from the last sample
+//					to the first.  Each block is reversed into a scratch
+//					buffer, filtered, and reversed again into the output, so
+//					input and output may be the same buffer.
+//
+// Input Arguments:
+//		filters		= std::vector<Filter>&
+//		input		= const DatasetType*
+//		count		= const size_t&
+//		initialize	= const bool&, true to initialize each filter with the
+//					  last value of its input, false to continue from the
+//					  filters' current states
+//
+// Output Arguments:
+//		output		= DatasetType*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FilterChain::ProcessSerialReverse(std::vector<Filter>& filters, const DatasetType* input,
+	DatasetType* output, const size_t& count, const bool& initialize)
+{
+	std::vector<DatasetType> block(std::min(blockSize, count));
+	size_t blockEnd(count);
+	while (blockEnd > 0)
+	{
+		const size_t blockStart(blockEnd - std::min(blockSize, blockEnd));
+		const size_t length(blockEnd - blockStart);
+		std::reverse_copy(input + blockStart, input + blockEnd, block.begin());
+		for (auto& f : filters)
+		{
+			if (initialize && blockEnd == count)
+				f.Initialize(block.front());
+
+			f.Process(block.data(), block.data(), length);
+		}
+
+		std::reverse_copy(block.begin(), block.begin() + length, output + blockStart);
+		blockEnd = blockStart;
+	}
+}
+
+//=============================================================================
+// Class:			FilterChain
+// Function:		GetSettlingLength
+//
+// Description:		Determines the number of samples required for the effect
+//					of the initial state to decay, for the specified filters
+//					applied in series.
+//
+// Input Arguments:
+//		filters	= const std::vector<Filter>&
+//
+// Output Arguments:
+//		length	= size_t&
+//
+// Return Value:
+//		bool, false if the settling length of any filter is unknown
+//
+//=============================================================================
+bool FilterChain::GetSettlingLength(const std::vector<Filter>& filters, size_t& length)
+{
+	length = 0;
+	for (const auto& f : filters)
+	{
+		size_t filterLength;
+		if (!f.GetSettlingLength(settlingTolerance, filterLength))
+			return false;
+		length += filterLength;
+	}
+
+	return true;
+}
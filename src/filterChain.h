@@ -0,0 +1,104 @@
+// File:  filterChain.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Series of filters applied to sound data in a single pass.
+
+#ifndef FILTER_CHAIN_H_
+#define FILTER_CHAIN_H_
+
+// Local headers
+#include "filter.h"
+#include "dataset2D.h"
+
+// Standard C++ headers
+#include <vector>
+
+// Local forward declarations
+class FastConvolution;
+
+/// Applies a series of filters to a buffer of samples.  Rather than passing
+/// the entire buffer through each filter in turn, the data is processed in
+/// small blocks and each block is passed through every filter while it is
+/// still in cache.  The result is identical to applying the filters one at a
+/// time.
+///
+/// Long signals are divided into chunks which are filtered in parallel.  Each
+/// chunk after the first starts filtering early, over enough preceding
+/// samples that the filter state has settled (to within a small tolerance)
+/// by the start of the chunk.  Chunk boundaries depend only on the length of
+/// the signal and the filters, so results do not depend on the number of
+/// threads.  This is only possible when the filters' settling lengths are
+/// known; otherwise the signal is filtered serially.
+///
+/// Zero-phase filters are applied forward, then backward over the result of
+/// the forward pass.  The backward pass works in place, reversing one block
+/// at a time into a small scratch buffer, so no additional copy of the signal
+/// is required.  Causal filters preceding a zero-phase filter are combined
+/// with its forward pass.
+///
+/// FIR filters with long impulse responses are applied separately from the
+/// other filters, using FFT-based fast convolution.
+class FilterChain
+{
+public:
+	/// Constructor.
+	///
+	/// \param filters   Filters to apply, in order.  The chain uses its own
+	///                  copies, so the state of \p filters is not modified.
+	/// \param zeroPhase Flags indicating which filters are applied with zero
+	///                  phase (forward and backward).  If empty, all filters
+	///                  are applied forward only.
+	explicit FilterChain(const std::vector<Filter>& filters,
+		const std::vector<bool>& zeroPhase = std::vector<bool>());
+
+	/// Filters the specified samples.  \p input and \p output may refer to
+	/// the same buffer, in which case the data is filtered in place.  Each
+	/// filter is initialized with the first value of its input (for the
+	/// backward pass of a zero-phase filter, this is the last value of the
+	/// forward pass).
+	///
+	/// \param input  Samples to filter.
+	/// \param output Location to store filtered samples.
+	/// \param count  Number of samples in \p input and \p output.
+	void Process(const DatasetType* input, DatasetType* output, const size_t& count);
+
+	/// Filters the specified samples in place.
+	///
+	/// \param samples Samples to filter.
+	void Process(std::vector<DatasetType>& samples) { Process(samples.data(), samples.data(), samples.size()); }
+
+	bool IsEmpty() const { return filters.empty(); }
+
+private:
+	static const size_t blockSize;// [samples]
+	static const size_t minimumChunkLength;// [samples]
+	static const double settlingTolerance;
+	static const size_t minimumFastConvolutionLength;// [taps]
+
+	std::vector<Filter> filters;
+	std::vector<bool> zeroPhase;
+
+	// Filters applied together in a single direction
+	struct Pass
+	{
+		std::vector<Filter> filters;
+		bool reverse = false;
+		bool fastConvolution = false;// If true, filters contains a single FIR filter
+	};
+
+	std::vector<Pass> GetPasses() const;
+	static bool UseFastConvolution(const Filter& filter);
+
+	static void ProcessPass(Pass& pass, const DatasetType* input,
+		DatasetType* output, const size_t& count);
+	static void ProcessRange(std::vector<Filter>& filters, const FastConvolution* convolution,
+		const bool& reverse, const DatasetType* input, DatasetType* output, const size_t& count,
+		std::vector<DatasetType>& warmUp);
+	static bool GetSettlingLength(const std::vector<Filter>& filters, size_t& length);
+	static void ProcessSerial(std::vector<Filter>& filters, const DatasetType* input,
+		DatasetType* output, const size_t& count, const bool& initialize);
+	static void ProcessSerialReverse(std::vector<Filter>& filters, const DatasetType* input,
+		DatasetType* output, const size_t& count, const bool& initialize);
+};
+
+#endif// FILTER_CHAIN_H_
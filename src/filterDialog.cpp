@@ -15,6 +15,7 @@
 #include "filterDialog.h"
 #include "expressionTree.h"
 #include "filter.h"
+#include "iirDesign.h"
 
 // wxWidgets headers
 #include <wx/spinctrl.h>
@@ -44,6 +45,7 @@
 const unsigned int FilterDialog::mDefaultPrecision(2);
 const unsigned int FilterDialog::mCalculationPrecision(15);
 const unsigned int FilterDialog::mMaxFilterOrder(10000);
+const unsigned int FilterDialog::mMaxFIROrder(200000);
 
 //=============================================================================
 // Class:			FilterDialog
@@ -97,6 +99,7 @@ BEGIN_EVENT_TABLE(FilterDialog, wxDialog)
 	EVT_SPIN(SpinID,				FilterDialog::OnSpin)
 	EVT_RADIOBUTTON(RadioID,		FilterDialog::OnRadioChange)
 	EVT_CHECKBOX(ButterworthID,		FilterDialog::OnButterworthChange)
+	EVT_CHECKBOX(FIRID,				FilterDialog::OnFIRChange)
 	EVT_TEXT(TransferFunctionID,	FilterDialog::OnTransferFunctionChange)
 	EVT_TEXT(InputTextID,			FilterDialog::OnInputTextChange)
 END_EVENT_TABLE()
@@ -180,7 +183,7 @@ wxSizer* FilterDialog::CreateTextBoxes()
 	sizer->Add(mWidthBox, 0, wxEXPAND);
 
 	mOrderSpin = new wxSpinCtrl(this, SpinID, wxString::Format("%i", mParameters.order));
-	mOrderSpin->SetRange(1, mMaxFilterOrder);
+	mOrderSpin->SetRange(1, mParameters.fir ? mMaxFIROrder : mMaxFilterOrder);
 	sizer->Add(new wxStaticText(this, wxID_ANY, _T("Order")), wxALIGN_CENTER_VERTICAL);
 	sizer->Add(mOrderSpin);
 
@@ -213,6 +216,18 @@ wxSizer* FilterDialog::CreateCheckBoxes()
 	if (mParameters.butterworth)
 		mButterworthCheckBox->SetValue(true);
 
+	mFIRCheckBox = new wxCheckBox(this, FIRID, _T("Linear Phase FIR (Windowed Sinc)"));
+	sizer->Add(mFIRCheckBox, 0, wxALL, 2);
+
+	if (mParameters.fir)
+		mFIRCheckBox->SetValue(true);
+
+	mZeroPhaseCheckBox = new wxCheckBox(this, wxID_ANY, _T("Zero Phase (Forward-Backward)"));
+	sizer->Add(mZeroPhaseCheckBox, 0, wxALL, 2);
+
+	if (mParameters.zeroPhase)
+		mZeroPhaseCheckBox->SetValue(true);
+
 	return sizer;
 }
 
@@ -392,15 +407,61 @@ void FilterDialog::OnRadioChange(wxCommandEvent& WXUNUSED(event))
 	if (!mInitialized)
 		return;
 
-	if (mBandPassRadio->GetValue() || mBandStopRadio->GetValue())
-		mOrderSpin->SetRange(2, mMaxFilterOrder);
-	else
-		mOrderSpin->SetRange(1, mMaxFilterOrder);
+	UpdateEnabledControls();
+	UpdateOrderRange();
+	UpdateTransferFunction();
+}
 
+//=============================================================================
+// Class:			FilterDialog
+// Function:		OnFIRChange
+//
+// Description:		Handles FIR check box change events.
+//
+// Input Arguments:
+//		event	= wxCommandEvent&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FilterDialog::OnFIRChange(wxCommandEvent& WXUNUSED(event))
+{
 	UpdateEnabledControls();
+	UpdateOrderRange();
 	UpdateTransferFunction();
 }
 
+//=============================================================================
+// Class:			FilterDialog
+// Function:		UpdateOrderRange
+//
+// Description:		Sets the limits of the order spin control according to
+//					the selected filter type.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FilterDialog::UpdateOrderRange()
+{
+	// FIR filters are applied with fast convolution, so much higher orders are practical
+	const unsigned int maxOrder(FIRSelected() ? mMaxFIROrder : mMaxFilterOrder);
+	if (!FIRSelected() && (mBandPassRadio->GetValue() || mBandStopRadio->GetValue()))
+		mOrderSpin->SetRange(2, maxOrder);
+	else
+		mOrderSpin->SetRange(1, maxOrder);
+}
+
 //=============================================================================
 // Class:			FilterDialog
 // Function:		OnButterworthChange
@@ -513,25 +574,31 @@ bool FilterDialog::TransferDataFromWindow()
 		UpdateTransferFunction();
 	}
 
-	double steadyStateGain = Filter::ComputeSteadyStateGain(
-		std::string(mNumeratorBox->GetValue().mb_str()), std::string(mDenominatorBox->GetValue().mb_str()));
-
-	if (!IsZero(steadyStateGain - 1.0) && !IsZero(steadyStateGain))
+	// FIR filters are designed directly, so the transfer function is not used
+	if (!FIRSelected())
 	{
-		if (wxMessageBox(wxString::Format(
-			"The steady-state gain for the specified filter is %f (typically 1.0 or 0.0).  Continue anyway?",
-			steadyStateGain), _T("Unusual Filter Gain"), wxICON_QUESTION + wxYES_NO, GetParent()) == wxNO)
+		double steadyStateGain = Filter::ComputeSteadyStateGain(
+			std::string(mNumeratorBox->GetValue().mb_str()), std::string(mDenominatorBox->GetValue().mb_str()));
+
+		if (!IsZero(steadyStateGain - 1.0) && !IsZero(steadyStateGain))
 		{
-			mNumeratorBox->SetValue(originalNumerator);
-			mDenominatorBox->SetValue(originalDenominator);
-			mStringPrecision = activePrecision;
+			if (wxMessageBox(wxString::Format(
+				"The steady-state gain for the specified filter is %f (typically 1.0 or 0.0).  Continue anyway?",
+				steadyStateGain), _T("Unusual Filter Gain"), wxICON_QUESTION + wxYES_NO, GetParent()) == wxNO)
+			{
+				mNumeratorBox->SetValue(originalNumerator);
+				mDenominatorBox->SetValue(originalDenominator);
+				mStringPrecision = activePrecision;
 
-			return false;
+				return false;
+			}
 		}
 	}
 
 	mParameters.order = mOrderSpin->GetValue();
 	mParameters.butterworth = mButterworthCheckBox->GetValue();
+	mParameters.fir = FIRSelected();
+	mParameters.zeroPhase = mZeroPhaseCheckBox->GetValue();
 	mParameters.numerator = mNumeratorBox->GetValue();
 	mParameters.denominator = mDenominatorBox->GetValue();
 	mParameters.type = GetType();
@@ -539,8 +606,8 @@ bool FilterDialog::TransferDataFromWindow()
 	if (!CutoffFrequencyIsValid() ||
 		!DampingRatioIsValid() ||
 		!WidthIsValid() ||
-		!ExpressionIsValid(mNumeratorBox->GetValue()) ||
-		!ExpressionIsValid(mDenominatorBox->GetValue()))
+		(!FIRSelected() && (!ExpressionIsValid(mNumeratorBox->GetValue()) ||
+		!ExpressionIsValid(mDenominatorBox->GetValue()))))
 	{
 		mNumeratorBox->SetValue(originalNumerator);
 		mDenominatorBox->SetValue(originalDenominator);
@@ -707,7 +774,7 @@ bool FilterDialog::ExpressionIsValid(const wxString &expression)
 //=============================================================================
 void FilterDialog::UpdateTransferFunction()
 {
-	if (!mInitialized || mCustomRadio->GetValue())
+	if (!mInitialized || mCustomRadio->GetValue() || FIRSelected())
 		return;
 
 	mStringPrecision = DetermineStringPrecision();
@@ -787,14 +854,7 @@ unsigned int FilterDialog::DetermineStringPrecision() const
 wxString FilterDialog::GenerateButterworthDenominator(const unsigned int &order,
 	const double &cutoff) const
 {
-	std::vector<std::complex<double>> poles;
-	unsigned int i;
-	for (i = 0; i < order; ++i)
-		poles.push_back(std::complex<double>(cutoff, 0.0)
-			* std::pow(std::complex<double>(exp(1.0), 0.0),
-			std::complex<double>(0.0, (2.0 * (i + 1.0) + order - 1.0) * M_PI / (2.0 * order))));
-
-	return GenerateExpressionFromComplexRoots(poles);
+	return GenerateExpressionFromComplexRoots(IIRDesign::GetButterworthPoles(order, cutoff));
 }
 
 //=============================================================================
@@ -1187,14 +1247,19 @@ void FilterDialog::UpdateEnabledControls()
 		return;
 
 	mCutoffFrequencyBox->Enable(!mCustomRadio->GetValue());
-	mButterworthCheckBox->Enable(mLowPassRadio->GetValue() || mHighPassRadio->GetValue() ||
-		mBandStopRadio->GetValue() || mBandPassRadio->GetValue());
+	mFIRCheckBox->Enable(!mCustomRadio->GetValue());
+	mButterworthCheckBox->Enable(!FIRSelected() && (mLowPassRadio->GetValue() || mHighPassRadio->GetValue() ||
+		mBandStopRadio->GetValue() || mBandPassRadio->GetValue()));
 	mDampingRatioBox->Enable(DampingRatioInputRequired());
 
 	mOrderSpin->Enable(mLowPassRadio->GetValue() || mHighPassRadio->GetValue() ||
-		mBandStopRadio->GetValue() || mBandPassRadio->GetValue());
+		mBandStopRadio->GetValue() || mBandPassRadio->GetValue() ||
+		(FIRSelected() && mNotchRadio->GetValue()));
 	mWidthBox->Enable(mBandStopRadio->GetValue() || mBandPassRadio->GetValue() ||
 		mNotchRadio->GetValue());
+
+	mNumeratorBox->Enable(!FIRSelected());
+	mDenominatorBox->Enable(!FIRSelected());
 }
 
 //=============================================================================
@@ -1231,6 +1296,12 @@ wxString FilterDialog::GetFilterNamePrefix(const FilterParameters &parameters)
 	else
 		assert(false);
 
+	if (parameters.fir)
+		name.Append(_T(", Linear Phase FIR"));
+
+	if (parameters.zeroPhase)
+		name.Append(_T(", Zero Phase"));
+
 	return name;
 }
 
@@ -1453,7 +1524,7 @@ wxString FilterDialog::AddDampingName(const wxString& name,
 	const FilterParameters &parameters)
 {
 	wxString s(name);
-	if (parameters.order > 1)
+	if (parameters.order > 1 && !parameters.fir)
 	{
 		if (parameters.butterworth)
 			s.Append(_T(", Butterworth"));
@@ -1493,7 +1564,7 @@ wxString FilterDialog::AddWidthName(const wxString& name, const FilterParameters
 
 //=============================================================================
 // Class:			FilterDialog
-// Function:		ComputeLogCutoffs
+// Function:		ComputeLogCutoffs (static)
 //
 // Description:		Computes upper and lower cutoff frequencies for wide-band
 //					filters given the center frequency and width.
@@ -1511,7 +1582,7 @@ wxString FilterDialog::AddWidthName(const wxString& name, const FilterParameters
 //
 //=============================================================================
 void FilterDialog::ComputeLogCutoffs(const double &center, const double &width,
-	double &lowCutoff, double &highCutoff) const
+	double &lowCutoff, double &highCutoff)
 {
 	// Let the parameters exactly set the center frequency and upper cutoff
 	// Compute the lower cutoff using our log() method
@@ -1539,6 +1610,7 @@ void FilterDialog::ComputeLogCutoffs(const double &center, const double &width,
 bool FilterDialog::DampingRatioInputRequired()
 {
 	if ((mButterworthCheckBox->IsEnabled() && mButterworthCheckBox->GetValue()) ||
+		FIRSelected() ||
 		mCustomRadio->GetValue() ||
 		mNotchRadio->GetValue())
 		return false;
@@ -1554,6 +1626,28 @@ bool FilterDialog::DampingRatioInputRequired()
 	return false;
 }
 
+//=============================================================================
+// Class:			FilterDialog
+// Function:		FIRSelected
+//
+// Description:		Determines if the filter is to be implemented as an FIR
+//					filter.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//=============================================================================
+bool FilterDialog::FIRSelected() const
+{
+	return mFIRCheckBox->IsEnabled() && mFIRCheckBox->GetValue();
+}
+
 //=============================================================================
 // Class:			FilterDialog
 // Function:		OrderIsValid
@@ -49,6 +49,16 @@ struct FilterParameters
 	double dampingRatio = 1.0;///< Filter damping ratio.
 	double width = 250.0;///< Filter width. <b>[Hz]</b>
 
+	/// Flag indicating if the filter should be implemented as a linear-phase
+	/// FIR filter (windowed-sinc design) instead of from the transfer
+	/// function.  For FIR filters, the order is the number of taps minus one.
+	bool fir = false;
+
+	/// Flag indicating if the filter should be applied forward and then
+	/// backward, cancelling its phase shift (and squaring its magnitude
+	/// response).
+	bool zeroPhase = false;
+
 	wxString numerator;///< Numerator of transfer function.
 	wxString denominator;///< Denominator of transfer function.
 };
@@ -76,17 +86,31 @@ public:
 	/// \returns The appropriate prefix.
 	static wxString GetFilterNamePrefix(const FilterParameters &parameters);
 
+	/// Computes upper and lower cutoff frequencies for wide-band filters,
+	/// such that the center frequency is the geometric mean of the cutoffs.
+	///
+	/// \param center     Center frequency.
+	/// \param width      Width of the band (in the same units as
+	///                   \p center).
+	/// \param lowCutoff  Lower cutoff frequency.
+	/// \param highCutoff Upper cutoff frequency.
+	static void ComputeLogCutoffs(const double &center, const double &width,
+		double &lowCutoff, double &highCutoff);
+
 private:
 	static const unsigned int mDefaultPrecision;
 	static const unsigned int mCalculationPrecision;
 
 	static const unsigned int mMaxFilterOrder;
+	static const unsigned int mMaxFIROrder;
 
 	wxTextCtrl *mCutoffFrequencyBox;
 	wxTextCtrl *mDampingRatioBox;
 	wxTextCtrl *mWidthBox;
 
 	wxCheckBox *mButterworthCheckBox;
+	wxCheckBox *mFIRCheckBox;
+	wxCheckBox *mZeroPhaseCheckBox;
 
 	wxSpinCtrl *mOrderSpin;
 
@@ -110,12 +134,14 @@ private:
 	void OnSpin(wxSpinEvent &event);
 	void OnRadioChange(wxCommandEvent &event);
 	void OnButterworthChange(wxCommandEvent &event);
+	void OnFIRChange(wxCommandEvent &event);
 	void OnTransferFunctionChange(wxCommandEvent &event);
 	void OnInputTextChange(wxCommandEvent &event);
 
 	void HandleSpin();
 	void UpdateTransferFunction();
 	void UpdateEnabledControls();
+	void UpdateOrderRange();
 
 	FilterParameters::Type GetType() const;
 
@@ -145,6 +171,7 @@ private:
 	{
 		RadioID = wxID_HIGHEST + 200,
 		ButterworthID,
+		FIRID,
 		SpinID,
 		TransferFunctionID,
 		InputTextID
@@ -162,6 +189,7 @@ private:
 	bool ExpressionIsValid(const wxString& expression);
 
 	bool DampingRatioInputRequired();
+	bool FIRSelected() const;
 
 	static wxString GetOrderString(const unsigned int &order);
 	static wxString GetPrimaryName(const wxString& name, const FilterParameters &parameters);
@@ -175,9 +203,6 @@ private:
 	static wxString GetNotchName(const FilterParameters &parameters);
 	static wxString GetCustomName(const FilterParameters &parameters);
 
-	void ComputeLogCutoffs(const double &center, const double &width,
-		double &lowCutoff, double &highCutoff) const;
-
 	static unsigned int GetPrecision(const double &value,
 		const unsigned int &significantDigits = 2, const bool &dropTrailingZeros = true);
 	static unsigned int CountSignificantDigits(const wxString& valueString);
@@ -0,0 +1,138 @@
+// File:  filterPipeline.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Series of filters with cached intermediate results, so changes to the
+//        filter list only require re-filtering from the first changed filter.
+
+// Local headers
+#include "filterPipeline.h"
+#include "filterChain.h"
+#include "soundData.h"
+
+// Standard C++ headers
+#include <algorithm>
+#include <cassert>
+
+FilterPipeline::FilterPipeline(const size_t& memoryBudget) : memoryBudget(memoryBudget)
+{
+}
+
+void FilterPipeline::SetInput(const std::shared_ptr<const SoundData>& input)
+{
+	this->input = input;
+	stages.clear();
+}
+
+//=============================================================================
+// Class:			FilterPipeline
+// Function:		SetFilters
+//
+// Description:		Updates the list of filters.  Stages up to the first
+//					changed key keep their cached outputs; all later stages
+//					are marked as out of date.
+//
+// Input Arguments:
+//		filters		= const std::vector<Filter>&
+//		zeroPhase	= const std::vector<bool>&
+//		keys		= const std::vector<std::string>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void FilterPipeline::SetFilters(const std::vector<Filter>& filters, const std::vector<bool>& zeroPhase,
+	const std::vector<std::string>& keys)
+{
+	assert(filters.size() == keys.size() && filters.size() == zeroPhase.size());
+
+	size_t firstChanged(0);
+	while (firstChanged < std::min(stages.size(), keys.size()) && stages[firstChanged].key == keys[firstChanged])
+		++firstChanged;
+
+	stages.erase(stages.begin() + firstChanged, stages.end());
+
+	size_t i;
+	for (i = firstChanged; i < filters.size(); ++i)
+		stages.emplace_back(filters[i], zeroPhase[i], keys[i]);
+}
+
+//=============================================================================
+// Class:			FilterPipeline
+// Function:		GetOutput
+//
+// Description:		Returns the output of the last stage.  Computation
+//					resumes from the latest stage with a cached output.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::shared_ptr<const SoundData>
+//
+//=============================================================================
+std::shared_ptr<const SoundData> FilterPipeline::GetOutput()
+{
+	if (!input || stages.empty())
+		return input;
+
+	size_t i(stages.size());
+	while (i > 0 && !stages[i - 1].output)
+		--i;
+
+	std::shared_ptr<const SoundData> data(i == 0 ? input : stages[i - 1].output);
+	const size_t firstRetained(GetFirstRetainedStage());
+	while (i < stages.size())
+	{
+		// Stages which are not retained are combined with the next retained stage
+		const size_t end(std::max(i, firstRetained) + 1);
+		std::vector<Filter> filters;
+		std::vector<bool> zeroPhase;
+		for (; i < end; ++i)
+		{
+			filters.push_back(stages[i].filter);
+			zeroPhase.push_back(stages[i].zeroPhase);
+		}
+
+		auto output(std::make_shared<SoundData>(*data));
+		FilterChain(filters, zeroPhase).Process(output->GetSamples());
+		stages[end - 1].output = output;
+		data = output;
+	}
+
+	for (i = 0; i < firstRetained; ++i)
+		stages[i].output.reset();
+
+	return data;
+}
+
+//=============================================================================
+// Class:			FilterPipeline
+// Function:		GetFirstRetainedStage
+//
+// Description:		Determines the index of the first stage for which the
+//					output can be retained within the memory budget.  The last
+//					stage is always retained.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		size_t
+//
+//=============================================================================
+size_t FilterPipeline::GetFirstRetainedStage() const
+{
+	assert(input && !stages.empty());
+	const size_t stageSize(std::max<size_t>(input->GetNumberOfPoints() * sizeof(DatasetType), 1));
+	const size_t retainedCount(std::min(stages.size(), std::max<size_t>(memoryBudget / stageSize, 1)));
+	return stages.size() - retainedCount;
+}
@@ -0,0 +1,86 @@
+// File:  filterPipeline.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Series of filters with cached intermediate results, so changes to the
+//        filter list only require re-filtering from the first changed filter.
+
+#ifndef FILTER_PIPELINE_H_
+#define FILTER_PIPELINE_H_
+
+// Local headers
+#include "filter.h"
+
+// Standard C++ headers
+#include <vector>
+#include <string>
+#include <memory>
+
+// Local forward declarations
+class SoundData;
+
+/// Applies a series of filters to sound data, retaining the output of each
+/// stage.  Each stage is identified by a key describing its filter.  When the
+/// filters change, stages are compared by key, and only the first changed
+/// stage and those downstream of it are recomputed.  If the list of filters
+/// is unchanged, the previous output is returned without any filtering.
+///
+/// The output of the last stage is always retained.  Outputs of earlier
+/// stages are retained (starting from the end of the chain) as the memory
+/// budget allows; stages whose outputs are not retained are applied together
+/// with the next retained stage in a single pass.
+class FilterPipeline
+{
+public:
+	/// Constructor.
+	///
+	/// \param memoryBudget Maximum total size of retained stage outputs
+	///                     [bytes].
+	explicit FilterPipeline(const size_t& memoryBudget);
+
+	/// Sets the unfiltered data.  All cached results and filters are
+	/// discarded (filters are designed for a specific sample rate, so they
+	/// cannot be reused with new data); SetFilters() must be called again
+	/// before calling GetOutput().
+	///
+	/// \param input Data to filter.
+	void SetInput(const std::shared_ptr<const SoundData>& input);
+
+	/// Sets the filters to apply.
+	///
+	/// \param filters   Filters to apply, in order.
+	/// \param zeroPhase Flags indicating which filters are applied with zero
+	///                  phase.
+	/// \param keys      Identifiers for each filter; the same key must always
+	///                  correspond to the same filter (including whether or
+	///                  not it is applied with zero phase).
+	void SetFilters(const std::vector<Filter>& filters, const std::vector<bool>& zeroPhase,
+		const std::vector<std::string>& keys);
+
+	/// Gets the filtered data, computing any stages which are out of date.
+	///
+	/// \returns The output of the last filter (or the input, if there are no
+	///          filters).
+	std::shared_ptr<const SoundData> GetOutput();
+
+private:
+	const size_t memoryBudget;// [bytes]
+
+	std::shared_ptr<const SoundData> input;
+
+	struct Stage
+	{
+		Stage(const Filter& filter, const bool& zeroPhase, const std::string& key)
+			: filter(filter), zeroPhase(zeroPhase), key(key) {}
+
+		Filter filter;
+		bool zeroPhase;
+		std::string key;
+		std::shared_ptr<const SoundData> output;// nullptr if out of date or not retained
+	};
+
+	std::vector<Stage> stages;
+
+	size_t GetFirstRetainedStage() const;
+};
+
+#endif// FILTER_PIPELINE_H_
@@ -0,0 +1,119 @@
+// File:  firDesign.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Design of linear-phase FIR filters using the windowed-sinc method.
+
+// Local headers
+#include "firDesign.h"
+
+// Standard C++ headers
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+
+std::vector<double> FIRDesign::LowPass(const double& cutoff,
+	const double& sampleRate, const unsigned int& order)
+{
+	return WindowedSinc(cutoff, sampleRate, order);
+}
+
+std::vector<double> FIRDesign::HighPass(const double& cutoff,
+	const double& sampleRate, const unsigned int& order)
+{
+	return Invert(WindowedSinc(cutoff, sampleRate, order));
+}
+
+std::vector<double> FIRDesign::BandPass(const double& lowCutoff, const double& highCutoff,
+	const double& sampleRate, const unsigned int& order)
+{
+	return Subtract(WindowedSinc(highCutoff, sampleRate, order), WindowedSinc(lowCutoff, sampleRate, order));
+}
+
+std::vector<double> FIRDesign::BandStop(const double& lowCutoff, const double& highCutoff,
+	const double& sampleRate, const unsigned int& order)
+{
+	return Invert(BandPass(lowCutoff, highCutoff, sampleRate, order));
+}
+
+//=============================================================================
+// Class:			FIRDesign
+// Function:		WindowedSinc (static)
+//
+// Description:		Computes the Blackman-windowed impulse response of an
+//					ideal low-pass filter, scaled for unity gain at DC.
+//
+// Input Arguments:
+//		cutoff		= const double& [Hz]
+//		sampleRate	= const double& [Hz]
+//		order		= const unsigned int&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<double>, containing order + 1 taps (after rounding the
+//		order up to an even number)
+//
+//=============================================================================
+std::vector<double> FIRDesign::WindowedSinc(const double& cutoff,
+	const double& sampleRate, const unsigned int& order)
+{
+	const unsigned int evenOrder(order + order % 2);
+	const double normalizedCutoff(std::max(0.0, std::min(cutoff / sampleRate, 0.5)));// [cycles/sample]
+	std::vector<double> impulseResponse(evenOrder + 1, 0.0);
+	if (normalizedCutoff == 0.0)
+		return impulseResponse;
+
+	double sum(0.0);
+	unsigned int i;
+	for (i = 0; i <= evenOrder; ++i)
+	{
+		const double x(2.0 * normalizedCutoff * (static_cast<double>(i) - 0.5 * evenOrder));
+		const double sinc(x == 0.0 ? 1.0 : sin(M_PI * x) / (M_PI * x));
+		const double window(evenOrder == 0 ? 1.0 : 0.42 - 0.5 * cos(2.0 * M_PI * i / evenOrder)
+			+ 0.08 * cos(4.0 * M_PI * i / evenOrder));
+		impulseResponse[i] = sinc * window;
+		sum += impulseResponse[i];
+	}
+
+	for (auto& h : impulseResponse)
+		h /= sum;
+
+	return impulseResponse;
+}
+
+//=============================================================================
+// Class:			FIRDesign
+// Function:		Invert (static)
+//
+// Description:		Converts a filter to its complement (i.e. low-pass to
+//					high-pass) by subtracting it from a delayed impulse.
+//
+// Input Arguments:
+//		impulseResponse	= std::vector<double>, containing an odd number of
+//						  taps
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<double>
+//
+//=============================================================================
+std::vector<double> FIRDesign::Invert(std::vector<double> impulseResponse)
+{
+	assert(impulseResponse.size() % 2 == 1);
+	for (auto& h : impulseResponse)
+		h = -h;
+	impulseResponse[impulseResponse.size() / 2] += 1.0;
+	return impulseResponse;
+}
+
+std::vector<double> FIRDesign::Subtract(std::vector<double> a, const std::vector<double>& b)
+{
+	assert(a.size() == b.size());
+	size_t i;
+	for (i = 0; i < a.size(); ++i)
+		a[i] -= b[i];
+	return a;
+}
@@ -0,0 +1,72 @@
+// File:  firDesign.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Design of linear-phase FIR filters using the windowed-sinc method.
+
+#ifndef FIR_DESIGN_H_
+#define FIR_DESIGN_H_
+
+// Standard C++ headers
+#include <vector>
+
+/// Functions for designing linear-phase (symmetric) FIR filters.  The ideal
+/// (brick-wall) impulse response is truncated to order + 1 taps and
+/// multiplied by a Blackman window, which gives roughly 74 dB of stop-band
+/// attenuation with a transition width of about 5.5 * sampleRate / order.
+/// Orders are rounded up to the next even number, so the delay of each
+/// filter (order / 2 samples) is an integer and high-pass and band-stop
+/// responses are possible.  Frequencies above the Nyquist frequency are
+/// limited to the Nyquist frequency.
+class FIRDesign
+{
+public:
+	/// Designs a low-pass filter with unity gain at DC.
+	///
+	/// \param cutoff     Cutoff frequency <b>[Hz]</b>.
+	/// \param sampleRate Sample rate <b>[Hz]</b>.
+	/// \param order      Filter order (number of taps minus one).
+	///
+	/// \returns The impulse response of the filter.
+	static std::vector<double> LowPass(const double& cutoff,
+		const double& sampleRate, const unsigned int& order);
+
+	/// Designs a high-pass filter.
+	///
+	/// \param cutoff     Cutoff frequency <b>[Hz]</b>.
+	/// \param sampleRate Sample rate <b>[Hz]</b>.
+	/// \param order      Filter order (number of taps minus one).
+	///
+	/// \returns The impulse response of the filter.
+	static std::vector<double> HighPass(const double& cutoff,
+		const double& sampleRate, const unsigned int& order);
+
+	/// Designs a band-pass filter.
+	///
+	/// \param lowCutoff  Lower edge of the pass band <b>[Hz]</b>.
+	/// \param highCutoff Upper edge of the pass band <b>[Hz]</b>.
+	/// \param sampleRate Sample rate <b>[Hz]</b>.
+	/// \param order      Filter order (number of taps minus one).
+	///
+	/// \returns The impulse response of the filter.
+	static std::vector<double> BandPass(const double& lowCutoff, const double& highCutoff,
+		const double& sampleRate, const unsigned int& order);
+
+	/// Designs a band-stop filter.
+	///
+	/// \param lowCutoff  Lower edge of the stop band <b>[Hz]</b>.
+	/// \param highCutoff Upper edge of the stop band <b>[Hz]</b>.
+	/// \param sampleRate Sample rate <b>[Hz]</b>.
+	/// \param order      Filter order (number of taps minus one).
+	///
+	/// \returns The impulse response of the filter.
+	static std::vector<double> BandStop(const double& lowCutoff, const double& highCutoff,
+		const double& sampleRate, const unsigned int& order);
+
+private:
+	static std::vector<double> WindowedSinc(const double& cutoff,
+		const double& sampleRate, const unsigned int& order);
+	static std::vector<double> Invert(std::vector<double> impulseResponse);
+	static std::vector<double> Subtract(std::vector<double> a, const std::vector<double>& b);
+};
+
+#endif// FIR_DESIGN_H_
@@ -0,0 +1,148 @@
+// File:  iirDesign.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Design of IIR filters from the poles and zeros of analog prototypes.
+
+// Local headers
+#include "iirDesign.h"
+
+// Standard C++ headers
+#include <cmath>
+
+namespace
+{
+const double pi(4.0 * std::atan(1.0));
+}
+
+Filter IIRDesign::LowPass(const double& cutoff, const double& sampleRate,
+	const unsigned int& order, const bool& butterworth, const double& dampingRatio)
+{
+	const double omega(2.0 * pi * cutoff);
+	return Filter(sampleRate, std::vector<std::complex<double>>(),
+		GetPoles(order, omega, butterworth, dampingRatio), std::pow(omega, order));
+}
+
+Filter IIRDesign::HighPass(const double& cutoff, const double& sampleRate,
+	const unsigned int& order, const bool& butterworth, const double& dampingRatio)
+{
+	return Filter(sampleRate, std::vector<std::complex<double>>(order, 0.0),
+		GetPoles(order, 2.0 * pi * cutoff, butterworth, dampingRatio), 1.0);
+}
+
+Filter IIRDesign::BandPass(const double& lowCutoff, const double& highCutoff,
+	const double& sampleRate, const unsigned int& order, const bool& butterworth,
+	const double& dampingRatio)
+{
+	const unsigned int lowPassOrder(order / 2);
+	const double highOmega(2.0 * pi * highCutoff);
+	std::vector<std::complex<double>> poles(GetPoles(lowPassOrder, highOmega, butterworth, dampingRatio));
+	const std::vector<std::complex<double>> highPassPoles(GetPoles(order - lowPassOrder,
+		2.0 * pi * lowCutoff, butterworth, dampingRatio));
+	poles.insert(poles.end(), highPassPoles.begin(), highPassPoles.end());
+
+	return Filter(sampleRate, std::vector<std::complex<double>>(order - lowPassOrder, 0.0),
+		poles, std::pow(highOmega, lowPassOrder));
+}
+
+Filter IIRDesign::Notch(const double& center, const double& width, const double& sampleRate)
+{
+	const double omega(2.0 * pi * center);
+	const std::vector<std::complex<double>> zeros({ std::complex<double>(0.0, omega),
+		std::complex<double>(0.0, -omega) });
+	return Filter(sampleRate, zeros, GetStandardPoles(2, omega, width / center * 0.5), 1.0);
+}
+
+//=============================================================================
+// Class:			IIRDesign
+// Function:		GetButterworthPoles (static)
+//
+// Description:		Computes the poles of a Butterworth filter, which are
+//					evenly spaced on the left half of the circle with radius
+//					equal to the cutoff frequency.
+//
+// Input Arguments:
+//		order	= const unsigned int&
+//		cutoff	= const double& [rad/sec]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<std::complex<double>>
+//
+//=============================================================================
+std::vector<std::complex<double>> IIRDesign::GetButterworthPoles(
+	const unsigned int& order, const double& cutoff)
+{
+	std::vector<std::complex<double>> poles;
+	unsigned int i;
+	for (i = 0; i < order / 2; ++i)
+	{
+		const std::complex<double> p(std::polar(cutoff, 0.5 * pi + (2.0 * i + 1.0) * pi / (2.0 * order)));
+		poles.push_back(p);
+		poles.push_back(std::conj(p));
+	}
+
+	if (order % 2 == 1)
+		poles.push_back(-cutoff);
+
+	return poles;
+}
+
+//=============================================================================
+// Class:			IIRDesign
+// Function:		GetStandardPoles (static)
+//
+// Description:		Computes the poles of the characteristic equation
+//					(s^2 + 2 * zeta * omega * s + omega^2)^(order / 2), with
+//					an additional factor of (s + omega) for odd orders.
+//
+// Input Arguments:
+//		order			= const unsigned int&
+//		cutoff			= const double& [rad/sec]
+//		dampingRatio	= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<std::complex<double>>
+//
+//=============================================================================
+std::vector<std::complex<double>> IIRDesign::GetStandardPoles(
+	const unsigned int& order, const double& cutoff, const double& dampingRatio)
+{
+	std::complex<double> first, second;
+	if (dampingRatio < 1.0)
+	{
+		first = std::complex<double>(-dampingRatio * cutoff, cutoff * std::sqrt(1.0 - dampingRatio * dampingRatio));
+		second = std::conj(first);
+	}
+	else
+	{
+		const double root(std::sqrt(dampingRatio * dampingRatio - 1.0));
+		first = -cutoff * (dampingRatio - root);
+		second = -cutoff * (dampingRatio + root);
+	}
+
+	std::vector<std::complex<double>> poles;
+	unsigned int i;
+	for (i = 0; i < order / 2; ++i)
+	{
+		poles.push_back(first);
+		poles.push_back(second);
+	}
+
+	if (order % 2 == 1)
+		poles.push_back(-cutoff);
+
+	return poles;
+}
+
+std::vector<std::complex<double>> IIRDesign::GetPoles(const unsigned int& order,
+	const double& cutoff, const bool& butterworth, const double& dampingRatio)
+{
+	if (butterworth)
+		return GetButterworthPoles(order, cutoff);
+	return GetStandardPoles(order, cutoff, dampingRatio);
+}
@@ -0,0 +1,99 @@
+// File:  iirDesign.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Design of IIR filters from the poles and zeros of analog prototypes.
+
+#ifndef IIR_DESIGN_H_
+#define IIR_DESIGN_H_
+
+// Local headers
+#include "filter.h"
+
+// Standard C++ headers
+#include <vector>
+#include <complex>
+
+/// Functions for designing the IIR filters offered by FilterDialog.  The
+/// continuous-time transfer functions are the same as those displayed by the
+/// dialog, but the filters are created from the poles and zeros rather than
+/// from the polynomial coefficients.  Finding the roots of the expanded
+/// polynomials is poorly conditioned at high orders (especially for narrow
+/// band-pass filters, whose poles are tightly clustered), so this is more
+/// accurate.  Poles are either those of a Butterworth filter, or repeated
+/// pairs with the specified damping ratio (plus one real pole for odd orders).
+class IIRDesign
+{
+public:
+	/// Designs a low-pass filter with unity gain at DC.
+	///
+	/// \param cutoff       Cutoff frequency <b>[Hz]</b>.
+	/// \param sampleRate   Sample rate <b>[Hz]</b>.
+	/// \param order        Filter order.
+	/// \param butterworth  Flag indicating whether the poles should be
+	///                     Butterworth poles.
+	/// \param dampingRatio Damping ratio of the poles (ignored for
+	///                     Butterworth filters).
+	///
+	/// \returns The filter.
+	static Filter LowPass(const double& cutoff, const double& sampleRate,
+		const unsigned int& order, const bool& butterworth, const double& dampingRatio);
+
+	/// Designs a high-pass filter with unity gain at high frequencies.
+	///
+	/// \param cutoff       Cutoff frequency <b>[Hz]</b>.
+	/// \param sampleRate   Sample rate <b>[Hz]</b>.
+	/// \param order        Filter order.
+	/// \param butterworth  Flag indicating whether the poles should be
+	///                     Butterworth poles.
+	/// \param dampingRatio Damping ratio of the poles (ignored for
+	///                     Butterworth filters).
+	///
+	/// \returns The filter.
+	static Filter HighPass(const double& cutoff, const double& sampleRate,
+		const unsigned int& order, const bool& butterworth, const double& dampingRatio);
+
+	/// Designs a band-pass filter as the product of a low-pass filter at the
+	/// upper cutoff (with half of the order, rounded down) and a high-pass
+	/// filter at the lower cutoff (with the remainder of the order).
+	///
+	/// \param lowCutoff    Lower edge of the pass band <b>[Hz]</b>.
+	/// \param highCutoff   Upper edge of the pass band <b>[Hz]</b>.
+	/// \param sampleRate   Sample rate <b>[Hz]</b>.
+	/// \param order        Filter order.
+	/// \param butterworth  Flag indicating whether the poles should be
+	///                     Butterworth poles.
+	/// \param dampingRatio Damping ratio of the poles (ignored for
+	///                     Butterworth filters).
+	///
+	/// \returns The filter.
+	static Filter BandPass(const double& lowCutoff, const double& highCutoff,
+		const double& sampleRate, const unsigned int& order, const bool& butterworth,
+		const double& dampingRatio);
+
+	/// Designs a second-order notch filter.
+	///
+	/// \param center     Frequency of the notch <b>[Hz]</b>.
+	/// \param width      Width of the notch <b>[Hz]</b>.
+	/// \param sampleRate Sample rate <b>[Hz]</b>.
+	///
+	/// \returns The filter.
+	static Filter Notch(const double& center, const double& width, const double& sampleRate);
+
+	/// Computes the poles of a Butterworth filter.  Complex poles are exact
+	/// conjugates, and the real pole (for odd orders) is exactly real.
+	///
+	/// \param order  Filter order.
+	/// \param cutoff Cutoff frequency <b>[rad/sec]</b>.
+	///
+	/// \returns The poles.
+	static std::vector<std::complex<double>> GetButterworthPoles(
+		const unsigned int& order, const double& cutoff);
+
+private:
+	static std::vector<std::complex<double>> GetStandardPoles(
+		const unsigned int& order, const double& cutoff, const double& dampingRatio);
+	static std::vector<std::complex<double>> GetPoles(const unsigned int& order,
+		const double& cutoff, const bool& butterworth, const double& dampingRatio);
+};
+
+#endif// IIR_DESIGN_H_
@@ -0,0 +1,125 @@
+// File:  magnitudeMatrix.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Contiguous, aligned time-frequency matrix of spectral magnitudes.
+
+// Local headers
+#include "magnitudeMatrix.h"
+
+// Standard C++ headers
+#include <algorithm>
+#include <limits>
+
+const size_t MagnitudeMatrix::alignment(64);
+
+MagnitudeMatrix::MagnitudeMatrix(const size_t& sliceCount, const size_t& binCount,
+	const Layout& layout) : sliceCount(sliceCount), binCount(binCount), layout(layout)
+{
+	// Round the row length up to a whole number of cache lines
+	const size_t elementsPerLine(alignment / sizeof(DatasetType));
+	stride = (GetRowLength() + elementsPerLine - 1) / elementsPerLine * elementsPerLine;
+	data.resize(stride * GetRowCount(), static_cast<DatasetType>(0.0));
+}
+
+//=============================================================================
+// Class:			MagnitudeMatrix
+// Function:		Transposed
+//
+// Description:		Returns a copy of the specified bins of this matrix,
+//					stored in the other layout.  Elements are copied in square
+//					tiles small enough that the source and destination tiles
+//					both stay in L1 cache.
+//
+// Input Arguments:
+//		firstBin	= const size_t&
+//		count		= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		MagnitudeMatrix
+//
+//=============================================================================
+MagnitudeMatrix MagnitudeMatrix::Transposed(const size_t& firstBin, const size_t& count) const
+{
+	assert(firstBin + count <= binCount);
+	MagnitudeMatrix t(sliceCount, count,
+		layout == Layout::TimeMajor ? Layout::FrequencyMajor : Layout::TimeMajor);
+
+	// Work in terms of the source rows and columns, restricted to the requested bins
+	const bool rowsAreSlices(layout == Layout::TimeMajor);
+	const size_t firstRow(rowsAreSlices ? 0 : firstBin);
+	const size_t rowCount(rowsAreSlices ? sliceCount : count);
+	const size_t firstColumn(rowsAreSlices ? firstBin : 0);
+	const size_t columnCount(rowsAreSlices ? count : sliceCount);
+
+	const size_t tileSize(32);
+	size_t tileRow, tileColumn, i, j;
+	for (tileRow = 0; tileRow < rowCount; tileRow += tileSize)
+	{
+		const size_t rowEnd(std::min(tileRow + tileSize, rowCount));
+		for (tileColumn = 0; tileColumn < columnCount; tileColumn += tileSize)
+		{
+			const size_t columnEnd(std::min(tileColumn + tileSize, columnCount));
+			for (i = tileRow; i < rowEnd; ++i)
+			{
+				const DatasetType* source(GetRow(firstRow + i) + firstColumn);
+				for (j = tileColumn; j < columnEnd; ++j)
+					t.data[j * t.stride + i] = source[j];
+			}
+		}
+	}
+
+	return t;
+}
+
+//=============================================================================
+// Class:			MagnitudeMatrix
+// Function:		ComputeRange
+//
+// Description:		Determines the minimum and maximum elements within the
+//					specified bins, excluding row padding.
+//
+// Input Arguments:
+//		firstBin	= const size_t&
+//		count		= const size_t&
+//
+// Output Arguments:
+//		minimum		= DatasetType&
+//		maximum		= DatasetType&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void MagnitudeMatrix::ComputeRange(const size_t& firstBin, const size_t& count,
+	DatasetType& minimum, DatasetType& maximum) const
+{
+	assert(firstBin + count <= binCount);
+	minimum = std::numeric_limits<DatasetType>::max();
+	maximum = std::numeric_limits<DatasetType>::lowest();
+
+	if (layout == Layout::TimeMajor)
+	{
+		size_t i;
+		for (i = 0; i < sliceCount; ++i)
+		{
+			const DatasetType* row(GetRow(i) + firstBin);
+			const auto minMax(std::minmax_element(row, row + count));
+			minimum = std::min(minimum, *minMax.first);
+			maximum = std::max(maximum, *minMax.second);
+		}
+	}
+	else
+	{
+		size_t i;
+		for (i = firstBin; i < firstBin + count; ++i)
+		{
+			const DatasetType* row(GetRow(i));
+			const auto minMax(std::minmax_element(row, row + sliceCount));
+			minimum = std::min(minimum, *minMax.first);
+			maximum = std::max(maximum, *minMax.second);
+		}
+	}
+}
@@ -0,0 +1,120 @@
+// File:  magnitudeMatrix.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Contiguous, aligned time-frequency matrix of spectral magnitudes.
+
+#ifndef MAGNITUDE_MATRIX_H_
+#define MAGNITUDE_MATRIX_H_
+
+// Local headers
+#include "dataset2D.h"
+#include "alignedAllocator.h"
+
+// Standard C++ headers
+#include <vector>
+#include <cassert>
+
+/// Class storing spectral magnitudes for a series of time slices in a single
+/// aligned allocation.  Each row (a time slice in TimeMajor layout, or a
+/// frequency bin in FrequencyMajor layout) begins on a cache line boundary;
+/// the distance between rows is given by GetStride().  Padding elements at
+/// the end of each row are zero and are not part of the data.
+class MagnitudeMatrix
+{
+public:
+	/// Enumeration of storage orders.
+	enum class Layout
+	{
+		TimeMajor,///< Each time slice is contiguous (natural for computing spectra)
+		FrequencyMajor///< Each frequency bin is contiguous (natural for drawing images)
+	};
+
+	MagnitudeMatrix() = default;
+
+	/// Constructor.  All elements are initialized to zero.
+	///
+	/// \param sliceCount Number of time slices.
+	/// \param binCount   Number of frequency bins.
+	/// \param layout     Storage order.
+	MagnitudeMatrix(const size_t& sliceCount, const size_t& binCount,
+		const Layout& layout = Layout::TimeMajor);
+
+	/// Returns a copy of this matrix in the other layout.  The copy is made
+	/// in small square tiles so both reads and writes remain cache-friendly.
+	/// \returns The transposed matrix.
+	MagnitudeMatrix Transposed() const { return Transposed(0, binCount); }
+
+	/// Returns a copy of a subset of the frequency bins of this matrix in the
+	/// other layout.
+	///
+	/// \param firstBin Index of the first bin to copy.
+	/// \param count    Number of bins to copy.
+	///
+	/// \returns The transposed matrix (with \p count bins).
+	MagnitudeMatrix Transposed(const size_t& firstBin, const size_t& count) const;
+
+	/// Determines the minimum and maximum values in the matrix (padding is
+	/// ignored).
+	///
+	/// \param minimum Minimum value (output).
+	/// \param maximum Maximum value (output).
+	void ComputeRange(DatasetType& minimum, DatasetType& maximum) const
+	{ ComputeRange(0, binCount, minimum, maximum); }
+
+	/// Determines the minimum and maximum values within a subset of the
+	/// frequency bins.
+	///
+	/// \param firstBin Index of the first bin to consider.
+	/// \param count    Number of bins to consider.
+	/// \param minimum  Minimum value (output).
+	/// \param maximum  Maximum value (output).
+	void ComputeRange(const size_t& firstBin, const size_t& count,
+		DatasetType& minimum, DatasetType& maximum) const;
+
+	/// Returns the number of bytes allocated for the matrix data.
+	inline size_t GetMemorySize() const { return data.size() * sizeof(DatasetType); }
+
+	/// Element access.
+	inline DatasetType& operator()(const size_t& slice, const size_t& bin)
+	{ return data[ComputeIndex(slice, bin)]; }
+	inline const DatasetType& operator()(const size_t& slice, const size_t& bin) const
+	{ return data[ComputeIndex(slice, bin)]; }
+
+	/// Row access (time slices for TimeMajor, bins for FrequencyMajor).
+	inline DatasetType* GetRow(const size_t& row) { return data.data() + row * stride; }
+	inline const DatasetType* GetRow(const size_t& row) const { return data.data() + row * stride; }
+
+	/// \name Private data accessors
+	/// @{
+
+	inline size_t GetSliceCount() const { return sliceCount; }
+	inline size_t GetBinCount() const { return binCount; }
+	inline size_t GetStride() const { return stride; }
+	inline Layout GetLayout() const { return layout; }
+	inline bool IsEmpty() const { return sliceCount == 0 || binCount == 0; }
+
+	inline size_t GetRowCount() const { return layout == Layout::TimeMajor ? sliceCount : binCount; }
+	inline size_t GetRowLength() const { return layout == Layout::TimeMajor ? binCount : sliceCount; }
+
+	/// @}
+
+private:
+	static const size_t alignment;// [bytes]
+
+	size_t sliceCount = 0;
+	size_t binCount = 0;
+	size_t stride = 0;
+	Layout layout = Layout::TimeMajor;
+
+	std::vector<DatasetType, AlignedAllocator<DatasetType>> data;
+
+	inline size_t ComputeIndex(const size_t& slice, const size_t& bin) const
+	{
+		assert(slice < sliceCount && bin < binCount);
+		if (layout == Layout::TimeMajor)
+			return slice * stride + bin;
+		return bin * stride + slice;
+	}
+};
+
+#endif// MAGNITUDE_MATRIX_H_
@@ -8,15 +8,19 @@
 #include "sonogrammerApp.h"
 #include "audioFile.h"
 #include "filter.h"
+#include "firDesign.h"
+#include "iirDesign.h"
 #include "soundData.h"
 #include "staticImage.h"
 #include "colorMapDialog.h"
 #include "dropTarget.h"
 #include "videoMaker.h"
 #include "waveFormGenerator.h"
+#include "averageSpectrumGenerator.h"
 #include "normalizer.h"
 #include "audioEncoderInterface.h"
 #include "radioDialog.h"
+#include "fftPlan.h"
 
 // wxWidgets headers
 #include <wx/listbox.h>
@@ -42,9 +46,15 @@ extern "C"
 #define __STDC_FORMAT_MACROS
 #include <inttypes.h>
 #include <sstream>
+#include <algorithm>
+#include <functional>
+
+const size_t MainFrame::spectrumCacheBudget(512 * 1024 * 1024);
+const size_t MainFrame::filterPipelineBudget(1024 * 1024 * 1024);
 
 MainFrame::MainFrame() : wxFrame(NULL, wxID_ANY, wxEmptyString,
-	wxDefaultPosition, wxDefaultSize, wxDEFAULT_FRAME_STYLE), audioRenderer(GetEventHandler())
+	wxDefaultPosition, wxDefaultSize, wxDEFAULT_FRAME_STYLE), audioRenderer(GetEventHandler()),
+	spectrumCache(spectrumCacheBudget), filterPipeline(filterPipelineBudget)
 {
 	CreateControls();
 	SetProperties();
@@ -99,6 +109,7 @@ BEGIN_EVENT_TABLE(MainFrame, wxFrame)
 	EVT_SLIDER(idFFT,								MainFrame::FFTSettingsChangedEvent)
 	EVT_TEXT(idFFT,									MainFrame::FFTSettingsChangedEvent)
 	EVT_COMBOBOX(idFFT,								MainFrame::FFTSettingsChangedEvent)
+	EVT_CHECKBOX(idFFT,								MainFrame::FFTSettingsChangedEvent)
 	EVT_COMMAND(wxID_ANY, RenderThreadInfoEvent,	MainFrame::OnRenderThreadInfoEvent)
 	EVT_CLOSE(										MainFrame::OnClose)
 END_EVENT_TABLE();
@@ -125,14 +136,28 @@ void MainFrame::CreateControls()
 	wxBoxSizer* rightSizer(new wxBoxSizer(wxVERTICAL));
 	mainSizer->Add(rightSizer, wxSizerFlags().Expand().Proportion(1));
 
-	sonogramImage = new StaticImage(panel, *this, wxID_ANY, 600, 200, true);
-	rightSizer->Add(sonogramImage, wxSizerFlags().Expand().Proportion(1));
+	// Average spectrum is drawn beside the sonogram, sharing its frequency axis
+	const unsigned int averageSpectrumWidth(120);
+	wxBoxSizer* sonogramSizer(new wxBoxSizer(wxHORIZONTAL));
+	rightSizer->Add(sonogramSizer, wxSizerFlags().Expand().Proportion(1));
+
+	sonogramImage = new StaticImage(panel, *this, wxID_ANY, 600, 200, true, true);
+	sonogramSizer->Add(sonogramImage, wxSizerFlags().Expand().Proportion(1));
+	sonogramSizer->AddSpacer(5);
+	averageSpectrumImage = new StaticImage(panel, *this, wxID_ANY, averageSpectrumWidth, sonogramImage->GetMinHeight(), true, false);
+	averageSpectrumImage->SetToolTip(_T("Average spectrum of selection"));
+	sonogramSizer->Add(averageSpectrumImage, wxSizerFlags().Expand());
 
 	rightSizer->AddSpacer(5);
 
+	// Wave form is kept the same width as the sonogram so the time axes line up
 	const double heightRatio(0.2);
-	waveFormImage = new StaticImage(panel, *this, wxID_ANY, sonogramImage->GetMinWidth(), heightRatio * sonogramImage->GetMinHeight(), false);
-	rightSizer->Add(waveFormImage, wxSizerFlags().Expand().Proportion(heightRatio));
+	wxBoxSizer* waveFormSizer(new wxBoxSizer(wxHORIZONTAL));
+	rightSizer->Add(waveFormSizer, wxSizerFlags().Expand().Proportion(heightRatio));
+
+	waveFormImage = new StaticImage(panel, *this, wxID_ANY, sonogramImage->GetMinWidth(), heightRatio * sonogramImage->GetMinHeight(), false, true);
+	waveFormSizer->Add(waveFormImage, wxSizerFlags().Expand().Proportion(1));
+	waveFormSizer->AddSpacer(5 + averageSpectrumWidth);
 
 	wxBoxSizer* rightBottomSizer(new wxBoxSizer(wxHORIZONTAL));
 	rightSizer->Add(rightBottomSizer);
@@ -333,6 +358,11 @@ wxSizer* MainFrame::CreateExportControls(wxWindow* parent)
 	innerSizer->Add(new wxStaticText(sizer->GetStaticBox(), wxID_ANY, _T("Video Bit Rate (kb/s)")));
 	innerSizer->Add(new wxTextCtrl(sizer->GetStaticBox(), wxID_ANY, wxEmptyString, wxDefaultPosition, wxDefaultSize, 0L, wxMakeIntegerValidator(&videoBitRate)));
 	
+	doublePrecisionVideoCheckBox = new wxCheckBox(sizer->GetStaticBox(), wxID_ANY, _T("Double Precision FFT"));
+	doublePrecisionVideoCheckBox->SetToolTip(_T("Compute exported sonograms with double precision FFTs (slower, but more accurate for large windows)"));
+	innerSizer->Add(doublePrecisionVideoCheckBox);
+	innerSizer->AddStretchSpacer();
+
 	exportVideoButton = new wxButton(sizer->GetStaticBox(), idExportVideo, _T("Export Video"));
 	exportVideoButton->Enable(false);
 	innerSizer->Add(exportVideoButton, wxSizerFlags().Expand());
@@ -369,6 +399,8 @@ wxSizer* MainFrame::CreateFFTControls(wxWindow* parent)
 	overlapTextBox = new wxTextCtrl(sizer->GetStaticBox(), idFFT, _T("0.7"));
 	autoUpdateWindow = new wxCheckBox(sizer->GetStaticBox(), wxID_ANY, _T("Auto-update Time Slice"));
 	autoUpdateWindow->SetValue(true);
+	bandLimitedCheckBox = new wxCheckBox(sizer->GetStaticBox(), idFFT, _T("Band-Limited (Chirp-Z)"));
+	bandLimitedCheckBox->SetToolTip(_T("Compute only the displayed frequency range, with finer frequency spacing"));
 
 	innerSizer->Add(new wxStaticText(sizer->GetStaticBox(), wxID_ANY, _T("Resolution (Hz)")));
 	innerSizer->Add(resolutionSlider, wxSizerFlags().Expand());
@@ -392,6 +424,7 @@ wxSizer* MainFrame::CreateFFTControls(wxWindow* parent)
 	innerSizer->Add(windowSizeText);
 	
 	innerSizer->Add(autoUpdateWindow);
+	innerSizer->Add(bandLimitedCheckBox);
 
 	return sizer;
 }
@@ -503,6 +536,8 @@ void MainFrame::LoadConfigButtonClickedEvent(wxCommandEvent& WXUNUSED(event))
 		overlapTextBox->SetValue(tempString);
 	if (config.Read(_T("fft/autoUpdateTimeSlice"), &tempBool))
 		autoUpdateWindow->SetValue(tempBool);
+	if (config.Read(_T("fft/bandLimited"), &tempBool))
+		bandLimitedCheckBox->SetValue(tempBool);
 	config.Read(_T("fft/timeSlice"), &currentTimeSlice, 0.0);
 		
 	if (config.Read(_T("sonogram/logarithmicFrequencyRange"), &tempBool))
@@ -519,6 +554,8 @@ void MainFrame::LoadConfigButtonClickedEvent(wxCommandEvent& WXUNUSED(event))
 	audioBitRate = tempLong;
 	config.Read(_T("video/videoBitRate"), &tempLong, videoBitRate);
 	videoBitRate = tempLong;
+	if (config.Read(_T("video/doublePrecision"), &tempBool))
+		doublePrecisionVideoCheckBox->SetValue(tempBool);
 	
 	TransferDataToWindow();
 }
@@ -540,6 +577,7 @@ void MainFrame::SaveConfigButtonClickedEvent(wxCommandEvent& WXUNUSED(event))
 	config.Write(_T("fft/windowFunction"), windowComboBox->GetStringSelection());
 	config.Write(_T("fft/overlap"), overlapTextBox->GetValue());
 	config.Write(_T("fft/autoUpdateTimeSlice"), autoUpdateWindow->GetValue());
+	config.Write(_T("fft/bandLimited"), bandLimitedCheckBox->GetValue());
 	if (!autoUpdateWindow->GetValue())
 		config.Write(_T("fft/timeSlice"), currentTimeSlice);
 	else
@@ -552,6 +590,7 @@ void MainFrame::SaveConfigButtonClickedEvent(wxCommandEvent& WXUNUSED(event))
 	config.Write(_T("video/height"), videoHeight);
 	config.Write(_T("video/audioBitRate"), audioBitRate);
 	config.Write(_T("video/videoBitRate"), videoBitRate);
+	config.Write(_T("video/doublePrecision"), doublePrecisionVideoCheckBox->GetValue());
 }
 
 void MainFrame::LoadRecipeButtonClickedEvent(wxCommandEvent& WXUNUSED(event))
@@ -719,6 +758,12 @@ bool MainFrame::LoadRecipe(const wxString& fileName, wxString& errorString)
 		return false;
 	}
 
+	// Could be an older file - don't generate an error
+	if (config.Read(_T("fft/bandLimited"), &tempBool))
+		bandLimitedCheckBox->SetValue(tempBool);
+	else
+		bandLimitedCheckBox->SetValue(false);
+
 	if (!config.Read(_T("fft/timeSlice"), &currentTimeSlice, 0.0))
 	{
 		errorString = _T("Failed to read 'fft/timeSlice' from '") + fileName + _T("'.");
@@ -774,6 +819,12 @@ bool MainFrame::LoadRecipe(const wxString& fileName, wxString& errorString)
 		return false;
 	}
 
+	// Could be an older file - don't generate an error
+	if (config.Read(_T("video/doublePrecision"), &tempBool))
+		doublePrecisionVideoCheckBox->SetValue(tempBool);
+	else
+		doublePrecisionVideoCheckBox->SetValue(false);
+
 	if (!TransferDataToWindow())
 	{
 		errorString = _T("Failed to transfer data to window");
@@ -864,6 +915,7 @@ bool MainFrame::SaveRecipe(const wxString& fileName, wxString& errorString)
 	config.Write(_T("fft/windowFunction"), windowComboBox->GetStringSelection());
 	config.Write(_T("fft/overlap"), overlapTextBox->GetValue());
 	config.Write(_T("fft/autoUpdateTimeSlice"), autoUpdateWindow->GetValue());
+	config.Write(_T("fft/bandLimited"), bandLimitedCheckBox->GetValue());
 	if (!autoUpdateWindow->GetValue())
 		config.Write(_T("fft/timeSlice"), currentTimeSlice);
 	else
@@ -880,6 +932,7 @@ bool MainFrame::SaveRecipe(const wxString& fileName, wxString& errorString)
 	config.Write(_T("video/height"), videoHeight);
 	config.Write(_T("video/audioBitRate"), audioBitRate);
 	config.Write(_T("video/videoBitRate"), videoBitRate);
+	config.Write(_T("video/doublePrecision"), doublePrecisionVideoCheckBox->GetValue());
 
 	return true;
 }
@@ -926,7 +979,8 @@ wxString MainFrame::SerializeFilterParameters(const std::vector<FilterParameters
 	for (const auto& f : fp)
 	{
 		ss << GetFilterTypeString(f.type) << ',' << static_cast<int>(f.butterworth) << ',' << f.order << ','
-			<< f.cutoffFrequency << ',' << f.dampingRatio << ',' << f.width << ',' << f.numerator << ',' << f.denominator << ';';
+			<< f.cutoffFrequency << ',' << f.dampingRatio << ',' << f.width << ',' << f.numerator << ',' << f.denominator << ','
+			<< static_cast<int>(f.zeroPhase) << ',' << static_cast<int>(f.fir) << ';';
 	}
 
 	return ss.str();
@@ -971,9 +1025,15 @@ FilterParameters MainFrame::DeserializeSingleFilterParameters(const wxString& s)
 	if (std::getline(ss, token, ','))
 		fp.numerator = token;
 
-	if (std::getline(ss, token, ';'))
+	if (std::getline(ss, token, ','))
 		fp.denominator = token;
-	
+
+	// Not present in settings saved by older versions
+	ss >> fp.zeroPhase;
+	ss.ignore();
+
+	ss >> fp.fir;
+
 	return fp;
 }
 
@@ -1032,7 +1092,10 @@ void MainFrame::AddFilterButtonClickedEvent(wxCommandEvent& WXUNUSED(event))
 
 	filterParameters.push_back(dialog.GetFilterParameters());
 	if (audioFile)
+	{
 		filters.push_back(GetFilter(filterParameters.back(), audioFile->GetSampleRate()));
+		CheckFilterDesign(filters.size() - 1);
+	}
 	else
 		filters.push_back(GetFilter(filterParameters.back(), 1.0));
 	filterList->Append(dialog.GetFilterNamePrefix(filterParameters.back()));
@@ -1044,11 +1107,66 @@ void MainFrame::AddFilterButtonClickedEvent(wxCommandEvent& WXUNUSED(event))
 
 Filter MainFrame::GetFilter(const FilterParameters &parameters, const double &sampleRate)
 {
+	if (parameters.fir && parameters.type != FilterParameters::Type::Custom)
+		return Filter::FromImpulseResponse(sampleRate, GetFIRImpulseResponse(parameters, sampleRate));
+
+	// Where the poles and zeros are known, use them directly rather than finding the roots of the transfer function
+	double lowCutoff, highCutoff;
+	switch (parameters.type)
+	{
+	case FilterParameters::Type::LowPass:
+		return IIRDesign::LowPass(parameters.cutoffFrequency, sampleRate, parameters.order,
+			parameters.butterworth, parameters.dampingRatio);
+
+	case FilterParameters::Type::HighPass:
+		return IIRDesign::HighPass(parameters.cutoffFrequency, sampleRate, parameters.order,
+			parameters.butterworth, parameters.dampingRatio);
+
+	case FilterParameters::Type::BandPass:
+		FilterDialog::ComputeLogCutoffs(parameters.cutoffFrequency, parameters.width, lowCutoff, highCutoff);
+		return IIRDesign::BandPass(lowCutoff, highCutoff, sampleRate, parameters.order,
+			parameters.butterworth, parameters.dampingRatio);
+
+	case FilterParameters::Type::Notch:
+		return IIRDesign::Notch(parameters.cutoffFrequency, parameters.width, sampleRate);
+
+	default:
+		break;
+	}
+
 	return Filter(sampleRate,
 		Filter::CoefficientsFromString(std::string(parameters.numerator.mb_str())),
 		Filter::CoefficientsFromString(std::string(parameters.denominator.mb_str())));
 }
 
+std::vector<double> MainFrame::GetFIRImpulseResponse(const FilterParameters &parameters, const double &sampleRate)
+{
+	switch (parameters.type)
+	{
+	case FilterParameters::Type::LowPass:
+		return FIRDesign::LowPass(parameters.cutoffFrequency, sampleRate, parameters.order);
+
+	case FilterParameters::Type::HighPass:
+		return FIRDesign::HighPass(parameters.cutoffFrequency, sampleRate, parameters.order);
+
+	case FilterParameters::Type::Notch:
+		return FIRDesign::BandStop(parameters.cutoffFrequency - 0.5 * parameters.width,
+			parameters.cutoffFrequency + 0.5 * parameters.width, sampleRate, parameters.order);
+
+	default:
+		break;
+	}
+
+	// Band edges are the same as for the equivalent transfer function
+	double lowCutoff, highCutoff;
+	FilterDialog::ComputeLogCutoffs(parameters.cutoffFrequency, parameters.width, lowCutoff, highCutoff);
+	if (parameters.type == FilterParameters::Type::BandPass)
+		return FIRDesign::BandPass(lowCutoff, highCutoff, sampleRate, parameters.order);
+
+	assert(parameters.type == FilterParameters::Type::BandStop);
+	return FIRDesign::BandStop(lowCutoff, highCutoff, sampleRate, parameters.order);
+}
+
 void MainFrame::RemoveFilterButtonClickedEvent(wxCommandEvent& WXUNUSED(event))
 {
 	wxArrayInt selections;
@@ -1091,7 +1209,10 @@ void MainFrame::FilterListDoubleClickEvent(wxCommandEvent& WXUNUSED(event))
 
 	filterParameters[selectedIndex] = dialog.GetFilterParameters();
 	if (audioFile)
+	{
 		filters[selectedIndex] = GetFilter(filterParameters[selectedIndex], audioFile->GetSampleRate());
+		CheckFilterDesign(selectedIndex);
+	}
 	else
 		filters[selectedIndex] = GetFilter(filterParameters[selectedIndex], 1.0);
 	filterList->Delete(selectedIndex);
@@ -1131,41 +1252,66 @@ void MainFrame::ApplyFilters()
 	if (!originalSoundData)
 		return;
 
-	filteredSoundData = std::make_unique<SoundData>(*originalSoundData);
-	for (auto& f : filters)
-		filteredSoundData = filteredSoundData->ApplyFilter(f);
+	// Only filters which have changed (and those after them) are re-applied
+	std::vector<bool> zeroPhase;
+	std::vector<std::string> filterKeys;
+	for (const auto& fp : filterParameters)
+	{
+		zeroPhase.push_back(fp.zeroPhase);
+		filterKeys.push_back(SerializeFilterParameters(std::vector<FilterParameters>(1, fp)).ToStdString());
+	}
+	filterPipeline.SetFilters(filters, zeroPhase, filterKeys);
+	filteredSoundData = filterPipeline.GetOutput();
 
+	double gainFactor(1.0);
 	addedGain->SetLabel(_T("0"));
 	if (applyNormalization->GetValue())
 	{
 		double normLeveldB;
 		if (normalizationLevel->GetValue().ToDouble(&normLeveldB))
-			ApplyNormalization(normLeveldB);
+			gainFactor = ApplyNormalization(normLeveldB);
 	}
+
+	// The filtered data is fully determined by the file, the filters and the normalization gain
+	const wxString dataDescription(wxString::Format(_T("%u;"), audioFileSerial)
+		+ SerializeFilterParameters(filterParameters) + wxString::Format(_T(";%.17g"), gainFactor));
+	filteredDataHash = std::hash<std::string>()(dataDescription.ToStdString());
 }
 
-void MainFrame::ApplyNormalization(const double& targetPower)
+// Returns the applied gain factor
+double MainFrame::ApplyNormalization(const double& targetPower)
 {
 	double startTime, endTime;
 	if (!GetTimeValues(startTime, endTime))
-		return;
+		return 1.0;
 
 	double normStartTime, normEndTime;
 	if (!GetNormalizationTimeValues(normStartTime, normEndTime))
-		return;
+		return 1.0;
 		
 	startTime = std::max(startTime, normStartTime);
 	endTime = std::min(endTime, normEndTime);
 		
 	if (endTime <= startTime)
-		return;// Could be in the middle of typing a number
+		return 1.0;// Could be in the middle of typing a number
 
-	auto segmentData(filteredSoundData->ExtractSegment(startTime, endTime));
+	const auto segmentData(filteredSoundData->ExtractSegment(startTime, endTime));
 
 	Normalizer normalizer;
-	const auto gainFactor(normalizer.ComputeGainFactor(*segmentData, targetPower, Normalizer::Method::Peak/*AWeighted*/));
-	normalizer.Normalize(*filteredSoundData, gainFactor);
+	const auto gainFactor(normalizer.ComputeGainFactor(segmentData, targetPower, Normalizer::Method::Peak/*AWeighted*/));
 	addedGain->SetLabel(wxString::Format(_T("%0.1f"), 20.0 * log10(gainFactor)));
+
+	if (filteredSoundData != normalizationInput || gainFactor != normalizationGain)
+	{
+		auto normalizedData(std::make_shared<SoundData>(*filteredSoundData));
+		normalizer.Normalize(*normalizedData, gainFactor);
+		normalizationInput = filteredSoundData;
+		normalizedSoundData = normalizedData;
+		normalizationGain = gainFactor;
+	}
+	filteredSoundData = normalizedSoundData;
+
+	return gainFactor;
 }
 
 void MainFrame::NormalizationSettingsChangedEvent(wxCommandEvent& WXUNUSED(event))
@@ -1197,7 +1343,6 @@ void MainFrame::FFTSettingsChangedEvent(wxCommandEvent& WXUNUSED(event))
 		return;
 
 	UpdateFFTCalculatedInformation();
-	ApplyFilters();
 	UpdateSonogram();
 }
 
@@ -1255,9 +1400,9 @@ void MainFrame::PlayButtonClickedEvent(wxCommandEvent& WXUNUSED(event))
 	}
 
 	if (includeFiltersInPlayback->GetValue())
-		audioRenderer.Play(*filteredSoundData->ExtractSegment(startTime, endTime));
+		audioRenderer.Play(filteredSoundData->ExtractSegment(startTime, endTime));
 	else
-		audioRenderer.Play(*originalSoundData->ExtractSegment(startTime, endTime));
+		audioRenderer.Play(originalSoundData->ExtractSegment(startTime, endTime));
 }
 
 void MainFrame::PauseButtonClickedEvent(wxCommandEvent& WXUNUSED(event))
@@ -1365,7 +1510,10 @@ bool MainFrame::ExportVideo(const wxString& fileName)
 	if (!GetTimeValues(startTime, endTime))
 		return false;
 
-	auto segmentData(filteredSoundData->ExtractSegment(startTime, endTime));
+	// Exports are not interactive, so the extra cost of double precision may be acceptable
+	parameters.doublePrecision = doublePrecisionVideoCheckBox->GetValue();
+
+	const auto segmentData(filteredSoundData->ExtractSegment(startTime, endTime));
 	VideoMaker videoMaker(videoWidth, videoHeight, audioBitRate * 1000, videoBitRate * 1000);
 	videoMaker.MakeVideo(segmentData, parameters, colorMap, fileName.ToStdString());
 
@@ -1404,7 +1552,7 @@ bool MainFrame::ExportAudio(const wxString& fileName)
 	if (!GetTimeValues(startTime, endTime))
 		return false;
 
-	auto segmentData(filteredSoundData->ExtractSegment(startTime, endTime));
+	const auto segmentData(filteredSoundData->ExtractSegment(startTime, endTime));
 	AudioEncoderInterface encoderInterface;
 	encoderInterface.Encode(fileName.ToStdString(), segmentData, audioBitRate * 1000);
 
@@ -1418,6 +1566,7 @@ void MainFrame::HandleNewAudioFile()
 	{
 		audioFile.reset();
 		sonogramImage->Reset();
+		averageSpectrumImage->Reset();
 		DisableFileDependentControls();
 		StopPlayingAudio();
 		return;
@@ -1428,6 +1577,7 @@ void MainFrame::HandleNewAudioFile()
 		wxMessageBox(_T("File '") + fileName + _T("' does not exist."));
 		audioFile.reset();
 		sonogramImage->Reset();
+		averageSpectrumImage->Reset();
 		DisableFileDependentControls();
 		StopPlayingAudio();
 		return;
@@ -1442,7 +1592,13 @@ void MainFrame::HandleNewAudioFile()
 	UpdateAudioInformation();
 	UpdateSonogramInformation();
 
-	originalSoundData = std::make_unique<SoundData>(audioFile->GetSoundData());
+	originalSoundData = std::make_shared<SoundData>(audioFile->GetSoundData());
+	++audioFileSerial;
+	spectrumCache.Clear();
+	averageSpectrum.reset();
+	filterPipeline.SetInput(originalSoundData);
+	normalizationInput.reset();
+	normalizedSoundData.reset();
 	UpdateFFTInformation();
 	UpdateFilterSampleRates();
 	ApplyFilters();
@@ -1454,7 +1610,17 @@ void MainFrame::UpdateFilterSampleRates()
 {
 	unsigned int i;
 	for (i = 0; i < filters.size(); ++i)
+	{
 		filters[i] = GetFilter(filterParameters[i], audioFile->GetSampleRate());
+		CheckFilterDesign(i);
+	}
+}
+
+void MainFrame::CheckFilterDesign(const unsigned int& i) const
+{
+	if (filters[i].SectionDesignFailed())
+		wxMessageBox(_T("Warning:  Filter '") + FilterDialog::GetFilterNamePrefix(filterParameters[i])
+			+ _T("' could not be implemented as stable second-order sections.  The result may be inaccurate or unstable."), _T("Warning"));
 }
 
 void MainFrame::UpdateAudioInformation()
@@ -1500,34 +1666,59 @@ void MainFrame::UpdateFFTResolutionLimits()
 	if (!GetFrequencyValues(dummy, maxImageFrequency))
 		return;
 
-	const double maxAllowedResolution(std::min(originalSoundData->GetSampleRate() / 2, static_cast<float>(maxImageFrequency)));
-	const unsigned int minSliderValue(static_cast<unsigned int>(ceil(log2(originalSoundData->GetSampleRate() / maxAllowedResolution) - 1.0)));
+	windowSizes = GetAvailableWindowSizes();
+	if (windowSizes.empty())
+		return;
 
-	resolutionSlider->Enable(true);
-	resolutionSlider->SetMin(0);// Min, then max, then min again to prevent GTK warning
-	resolutionSlider->SetMax(GetNumberOfResolutions());
-	resolutionSlider->SetMin(minSliderValue);
-	
 	// Automatic resolution determination maintains a nice-looking image, but when making videos it can be desirable to use
 	// different values (because we don't need to see the entire sonogram at once and because we might want to achieve a
 	// specific scroll rate).
-	if (autoUpdateWindow->GetValue() || currentTimeSlice == 0.0)
-		resolutionSlider->SetValue(resolutionSlider->GetMin() + (resolutionSlider->GetMax() - resolutionSlider->GetMin()) / 2);
-	else
+	unsigned int idealWindowSize(0);
+	if (!autoUpdateWindow->GetValue() && currentTimeSlice != 0.0)
 	{
 		double overlap;
 		if (!overlapTextBox->GetValue().ToDouble(&overlap))
 			return;
 
-		auto idealSliderPosition(log(currentTimeSlice * audioFile->GetSampleRate() / overlap) / log(2) - 1);
-		if (static_cast<int>(idealSliderPosition + 0.5) > resolutionSlider->GetMax())
+		// Any even window size can be used, so add the exact size for the desired time slice if it isn't already available
+		idealWindowSize = std::max(2U, 2 * static_cast<unsigned int>(currentTimeSlice * audioFile->GetSampleRate() / overlap / 2.0 + 0.5));
+		if (idealWindowSize > windowSizes.back())
 		{
 			wxMessageBox(_T("Warning:  Could not maintain desired time slice."), _T("Warning"));
-			resolutionSlider->SetValue(resolutionSlider->GetMax());
+			idealWindowSize = windowSizes.back();
 		}
 		else
-			resolutionSlider->SetValue(idealSliderPosition);
+		{
+			const auto position(std::lower_bound(windowSizes.begin(), windowSizes.end(), idealWindowSize));
+			if (*position != idealWindowSize)
+				windowSizes.insert(position, idealWindowSize);
+		}
+	}
+
+	const double maxAllowedResolution(std::min(originalSoundData->GetSampleRate() / 2, static_cast<float>(maxImageFrequency)));
+	const unsigned int minWindowSize(static_cast<unsigned int>(ceil(originalSoundData->GetSampleRate() / maxAllowedResolution)));
+	const int minSliderValue(std::min(std::lower_bound(windowSizes.begin(), windowSizes.end(), minWindowSize) - windowSizes.begin(),
+		static_cast<std::ptrdiff_t>(windowSizes.size() - 1)));
+
+	resolutionSlider->Enable(true);
+	resolutionSlider->SetMin(0);// Min, then max, then min again to prevent GTK warning
+	resolutionSlider->SetMax(windowSizes.size() - 1);
+	resolutionSlider->SetMin(minSliderValue);
+
+	if (idealWindowSize == 0)
+	{
+		// Default to the size nearest the geometric midpoint of the range (the list of sizes is dense at the upper end, so the
+		// middle index would be close to the largest size)
+		const int lowExponent(static_cast<int>(ceil(log2(windowSizes[minSliderValue]))));
+		const int highExponent(std::max(lowExponent, static_cast<int>(floor(log2(windowSizes.back())))));
+		const double targetSize(pow(2.0, lowExponent + (highExponent - lowExponent) / 2));
+		auto position(std::lower_bound(windowSizes.begin() + minSliderValue, windowSizes.end(), targetSize));
+		if (position == windowSizes.end() || (position != windowSizes.begin() + minSliderValue && targetSize / *(position - 1) < *position / targetSize))
+			--position;
+		resolutionSlider->SetValue(position - windowSizes.begin());
 	}
+	else
+		resolutionSlider->SetValue(std::lower_bound(windowSizes.begin(), windowSizes.end(), idealWindowSize) - windowSizes.begin());
 	currentTimeSlice = GetTimeSlice();
 }
 
@@ -1559,9 +1750,45 @@ void MainFrame::UpdateSonogram()
 	if (!GetFFTParameters(parameters))
 		return;
 
-	auto segmentData(filteredSoundData->ExtractSegment(startTime, endTime));
-	SonogramGenerator generator(*segmentData, parameters);
-	sonogramImage->SetImage(generator.GetImage(colorMap));
+	// Only the FFT parameters and the data affect the spectrum; the frequency
+	// range and color map are applied when the image is drawn (except that
+	// the maximum frequency determines the decimation factor, and band-limited
+	// spectra include only the requested range)
+	const SpectrumCache::Key key{ filteredDataHash, startTime, endTime,
+		parameters.windowFunction, parameters.windowSize, parameters.overlap,
+		SonogramGenerator::ComputeDecimationFactor(filteredSoundData->GetSampleRate(), parameters),
+		parameters.bandLimited,
+		parameters.bandLimited ? parameters.minFrequency : 0.0,
+		parameters.bandLimited ? parameters.maxFrequency : 0.0 };
+	auto spectrum(spectrumCache.Find(key));
+	if (!spectrum)
+	{
+		const auto segmentData(filteredSoundData->ExtractSegment(startTime, endTime));
+		spectrum = SonogramGenerator::ComputeSpectrum(segmentData, parameters);
+		spectrumCache.Add(key, spectrum);
+	}
+
+	SonogramGenerator generator(spectrum, filteredSoundData->GetSampleRate(), parameters);
+	sonogramImage->SetImage(generator.GetImage(GetColorTable()));
+
+	UpdateAverageSpectrum();
+}
+
+const SonogramGenerator::ColorTable& MainFrame::GetColorTable()
+{
+	const auto sameEntry([](const SonogramGenerator::MagnitudeColor& a, const SonogramGenerator::MagnitudeColor& b)
+	{
+		return a.magnitude == b.magnitude && a.color == b.color;
+	});
+
+	if (!colorTable || colorMap.size() != colorTableMap.size() ||
+		!std::equal(colorMap.begin(), colorMap.end(), colorTableMap.begin(), sameEntry))
+	{
+		colorTable = std::make_unique<SonogramGenerator::ColorTable>(colorMap);
+		colorTableMap = colorMap;
+	}
+
+	return *colorTable;
 }
 
 void MainFrame::UpdateWaveForm()
@@ -1576,16 +1803,50 @@ void MainFrame::UpdateWaveForm()
 	if (endTime <= startTime)
 		return;// Could be in the middle of typing a number
 
-	auto segmentData(filteredSoundData->ExtractSegment(startTime, endTime));
-	WaveFormGenerator generator(*segmentData);
+	const auto segmentData(filteredSoundData->ExtractSegment(startTime, endTime));
+	WaveFormGenerator generator(segmentData);
 	waveFormImage->SetImage(generator.GetImage(waveFormImage->GetSize().GetWidth(), waveFormImage->GetSize().GetHeight(),
 		SonogramGenerator::GetScaledColorFromMap(0.0, colorMap), SonogramGenerator::GetScaledColorFromMap(1.0, colorMap)));
 }
 
+void MainFrame::UpdateAverageSpectrum()
+{
+	if (!filteredSoundData || !ImageInformationComplete())
+		return;
+
+	double startTime, endTime;
+	if (!GetTimeValues(startTime, endTime))
+		return;
+
+	if (endTime <= startTime)
+		return;// Could be in the middle of typing a number
+
+	SonogramGenerator::FFTParameters parameters;
+	if (!GetFFTParameters(parameters))
+		return;
+
+	// The density is computed from the full-rate data with a fixed overlap, so
+	// only the data, time range and window affect it
+	const SpectrumCache::Key key{ filteredDataHash, startTime, endTime,
+		parameters.windowFunction, parameters.windowSize, AverageSpectrumGenerator::overlap, 1, false, 0.0, 0.0 };
+	if (!averageSpectrum || !(key == averageSpectrumKey))
+	{
+		const auto segmentData(filteredSoundData->ExtractSegment(startTime, endTime));
+		averageSpectrum = AverageSpectrumGenerator::ComputeDensity(segmentData, parameters);
+		averageSpectrumKey = key;
+	}
+
+	AverageSpectrumGenerator generator(averageSpectrum, filteredSoundData->GetSampleRate(), parameters);
+	averageSpectrumImage->SetImage(generator.GetImage(averageSpectrumImage->GetSize().GetWidth(), averageSpectrumImage->GetSize().GetHeight(),
+		SonogramGenerator::GetScaledColorFromMap(0.0, colorMap), SonogramGenerator::GetScaledColorFromMap(1.0, colorMap)));
+}
+
 bool MainFrame::GetFFTParameters(SonogramGenerator::FFTParameters& parameters)
 {
 	parameters.windowFunction = static_cast<FastFourierTransform::WindowType>(windowComboBox->GetSelection());
 	parameters.windowSize = GetWindowSize();
+	parameters.bandLimited = bandLimitedCheckBox->GetValue();
+	parameters.doublePrecision = false;// Interactive use is always single precision
 
 	if (!overlapTextBox->GetValue().ToDouble(&parameters.overlap))
 	{
@@ -1622,18 +1883,36 @@ bool MainFrame::ValidateInputs()
 	return ok;
 }
 
-unsigned int MainFrame::GetNumberOfResolutions()
+std::vector<unsigned int> MainFrame::GetAvailableWindowSizes()
 {
+	std::vector<unsigned int> sizes;
 	double startTime, endTime;
 	if (!GetTimeValues(startTime, endTime))
-		return 0;
+		return sizes;
 
 	const double currentDuration(endTime - startTime);
 	if (currentDuration <= 0.0)
-		return 0;
+		return sizes;
 
+	// Even sizes whose halves have no prime factors larger than seven, so
+	// adjacent resolutions are close together and every size is fast to
+	// transform (other sizes require Bluestein's algorithm)
 	const unsigned int numberOfPoints(currentDuration * audioFile->GetSampleRate());
-	return FastFourierTransform::GetMaxPowerOfTwo(numberOfPoints) - 1;
+	unsigned long long twos, threes, fives, sevens;
+	for (twos = 2; twos < numberOfPoints; twos *= 2)
+	{
+		for (threes = twos; threes < numberOfPoints; threes *= 3)
+		{
+			for (fives = threes; fives < numberOfPoints; fives *= 5)
+			{
+				for (sevens = fives; sevens < numberOfPoints; sevens *= 7)
+					sizes.push_back(static_cast<unsigned int>(sevens));
+			}
+		}
+	}
+
+	std::sort(sizes.begin(), sizes.end());
+	return sizes;
 }
 
 bool MainFrame::ImageInformationComplete() const
@@ -1699,7 +1978,9 @@ double MainFrame::GetResolution() const
 
 unsigned int MainFrame::GetWindowSize() const
 {
-	return pow(2, resolutionSlider->GetValue() + 1);
+	if (windowSizes.empty())
+		return 4;// Limits not yet computed; matches the initial slider position
+	return windowSizes[std::min(static_cast<size_t>(resolutionSlider->GetValue()), windowSizes.size() - 1)];
 }
 
 void MainFrame::EnableFileDependentControls()
@@ -1787,7 +2068,7 @@ void MainFrame::UpdateAudioPosition(const float& position)
 		sonogramImage->UpdateTimeCursor(position / (maxTime - minTime));
 }
 
-void MainFrame::UpdateSonogramCursorInfo(const double& timePercent, const double& frequencyPercent, const bool& hasFreqencyAxis)
+void MainFrame::UpdateSonogramCursorInfo(const double& timePercent, const double& frequencyPercent, const bool& hasFreqencyAxis, const bool& hasTimeAxis)
 {
 	if (!audioFile || timePercent < 0.0 || frequencyPercent < 0.0)
 	{
@@ -1809,7 +2090,10 @@ void MainFrame::UpdateSonogramCursorInfo(const double& timePercent, const double
 		return;
 	}
 
-	cursorTimeText->SetLabel(wxString::Format(_T("%f sec"), minTime + (maxTime - minTime) * timePercent));
+	if (hasTimeAxis)
+		cursorTimeText->SetLabel(wxString::Format(_T("%f sec"), minTime + (maxTime - minTime) * timePercent));
+	else
+		cursorTimeText->SetLabel(wxString());
 
 	if (hasFreqencyAxis)
 		cursorFrequencyText->SetLabel(wxString::Format(_T("%f Hz"), minFrequency + (maxFrequency - minFrequency) * frequencyPercent));
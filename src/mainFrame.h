@@ -10,6 +10,8 @@
 #include "sonogramGenerator.h"
 #include "audioRenderer.h"
 #include "filterDialog.h"
+#include "spectrumCache.h"
+#include "filterPipeline.h"
 
 // wxWidgets headers
 #include <wx/wx.h>
@@ -36,14 +38,14 @@ public:
 
 	void LoadFile(const wxString& fileName);
 
-	void UpdateSonogramCursorInfo(const double& timePercent, const double& frequencyPercent, const bool& hasFreqencyAxis);
+	void UpdateSonogramCursorInfo(const double& timePercent, const double& frequencyPercent, const bool& hasFreqencyAxis, const bool& hasTimeAxis);
 
 private:
 	void CreateControls();
 	void SetProperties();
 
-	std::unique_ptr<SoundData> originalSoundData;
-	std::unique_ptr<SoundData> filteredSoundData;
+	std::shared_ptr<const SoundData> originalSoundData;
+	std::shared_ptr<const SoundData> filteredSoundData;// Filtered and normalized
 
 	wxSizer* CreatePrimaryControls(wxWindow* parent);
 	wxSizer* CreateFilterControls(wxWindow* parent);
@@ -56,6 +58,7 @@ private:
 	// Controls
 	StaticImage* sonogramImage;
 	StaticImage* waveFormImage;
+	StaticImage* averageSpectrumImage;
 
 	wxTextCtrl* audioFileName;
 	wxButton* openAudioFileButton;
@@ -98,6 +101,7 @@ private:
 	wxStaticText* windowSizeText;
 	wxTextCtrl* overlapTextBox;
 	wxCheckBox* autoUpdateWindow;
+	wxCheckBox* bandLimitedCheckBox;
 
 	wxTextCtrl* timeMaxText;
 	wxTextCtrl* timeMinText;
@@ -108,6 +112,7 @@ private:
 	wxStaticText* cursorTimeText;
 	wxStaticText* cursorFrequencyText;
 
+	wxCheckBox* doublePrecisionVideoCheckBox;
 	wxButton* exportVideoButton;
 	wxButton* exportAudioButton;
 	wxStaticText* pixelsPerSecond;
@@ -188,9 +193,10 @@ private:
 	void UpdateSonogramInformation();
 	void UpdateSonogram();
 	void ApplyFilters();
-	void ApplyNormalization(const double& targetPower);
+	double ApplyNormalization(const double& targetPower);
 	void UpdateFFTResolutionLimits();
 	void UpdateWaveForm();
+	void UpdateAverageSpectrum();
 
 	void PopulatePlaybackDeviceList();
 
@@ -205,12 +211,16 @@ private:
 	std::vector<FilterParameters> filterParameters;
 
 	SonogramGenerator::ColorMap colorMap;
+	std::unique_ptr<SonogramGenerator::ColorTable> colorTable;
+	SonogramGenerator::ColorMap colorTableMap;// Map from which colorTable was built
+	const SonogramGenerator::ColorTable& GetColorTable();
 	static wxString SerializeColorMap(const SonogramGenerator::ColorMap& colorMap);
 	static SonogramGenerator::ColorMap DeserializeColorMap(const wxString& s);
 
 	bool GetFFTParameters(SonogramGenerator::FFTParameters& parameters);
 
-	unsigned int GetNumberOfResolutions();
+	std::vector<unsigned int> windowSizes;// Available at each resolution slider position
+	std::vector<unsigned int> GetAvailableWindowSizes();
 	double GetResolution() const;
 	unsigned int GetWindowSize() const;
 	double GetTimeSlice() const;
@@ -218,7 +228,10 @@ private:
 
 	static Filter GetFilter(const FilterParameters &parameters,
 		const double &sampleRate);
+	static std::vector<double> GetFIRImpulseResponse(const FilterParameters &parameters,
+		const double &sampleRate);
 	void UpdateFilterSampleRates();
+	void CheckFilterDesign(const unsigned int& i) const;
 
 	void EnableFileDependentControls();
 	void DisableFileDependentControls();
@@ -226,6 +239,25 @@ private:
 	AudioRenderer audioRenderer;
 	void StopPlayingAudio();
 
+	// Spectra are cached so changing display settings doesn't repeat the FFTs
+	SpectrumCache spectrumCache;
+	static const size_t spectrumCacheBudget;// [bytes]
+	unsigned int audioFileSerial = 0;// Incremented each time a file is loaded
+	size_t filteredDataHash = 0;// Identifies the content of filteredSoundData
+
+	// Most recent average spectrum, reused when only display settings change
+	SpectrumCache::Key averageSpectrumKey = SpectrumCache::Key();
+	std::shared_ptr<const std::vector<DatasetType>> averageSpectrum;
+
+	// Filter outputs are cached so only the stages affected by a change are recomputed
+	FilterPipeline filterPipeline;
+	static const size_t filterPipelineBudget;// [bytes]
+
+	// Most recent normalization, reused if neither the input nor the gain has changed
+	std::shared_ptr<const SoundData> normalizationInput;
+	std::shared_ptr<const SoundData> normalizedSoundData;
+	double normalizationGain = 1.0;
+
 	void SetControlEnablesOnPlay();
 	void SetControlEnablesOnStop();
 
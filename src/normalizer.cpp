@@ -10,10 +10,12 @@
 
 // Standard C++ headers
 #include <cmath>
+#include <vector>
+#include <algorithm>
 
 void Normalizer::Normalize(SoundData& soundData, const float& gainFactor) const
 {
-	for (auto& v : soundData.GetData().GetY())
+	for (auto& v : soundData.GetSamples())
 	{
 		v *= gainFactor;
 		if (v > 1.0f)
@@ -23,7 +25,7 @@ void Normalizer::Normalize(SoundData& soundData, const float& gainFactor) const
 	}
 }
 
-double Normalizer::ComputeGainFactor(const SoundData& soundData, double targetDecibels, const Method& method) const
+double Normalizer::ComputeGainFactor(const SoundDataView& soundData, double targetDecibels, const Method& method) const
 {
 	if (targetDecibels > 0.0)
 		targetDecibels = 0.0;
@@ -34,8 +36,7 @@ double Normalizer::ComputeGainFactor(const SoundData& soundData, double targetDe
 		const auto numerator(Filter::CoefficientsFromString("7397050000*s^4"));
 		const auto denominator(Filter::CoefficientsFromString("(s+129.4)^2 * (s+676.7) * (s+4636) * (s+76655)^2"));
 		Filter aWeightingFilter(soundData.GetSampleRate(), numerator, denominator);
-		auto weighted(soundData.ApplyFilter(aWeightingFilter));
-		peakAmplitude = GetPeakAmplitude(*weighted);
+		peakAmplitude = GetPeakAmplitude(soundData, aWeightingFilter);
 	}
 	else
 		peakAmplitude = GetPeakAmplitude(soundData);
@@ -44,10 +45,10 @@ double Normalizer::ComputeGainFactor(const SoundData& soundData, double targetDe
 	return targetAmplitude / peakAmplitude;
 }
 
-double Normalizer::GetPeakAmplitude(const SoundData& soundData) const
+double Normalizer::GetPeakAmplitude(const SoundDataView& soundData) const
 {
 	double minValue(0.0), maxValue(0.0);
-	for (auto& v : soundData.GetData().GetY())
+	for (const auto& v : soundData)
 	{
 		if (v < minValue)
 			minValue = v;
@@ -59,3 +60,29 @@ double Normalizer::GetPeakAmplitude(const SoundData& soundData) const
 		return maxValue;
 	return -minValue;
 }
+
+// Filters on the fly, so no copy of the data is required
+double Normalizer::GetPeakAmplitude(const SoundDataView& soundData, Filter& filter) const
+{
+	if (soundData.GetNumberOfPoints() == 0)
+		return 0.0;
+
+	double minValue(0.0), maxValue(0.0);
+	filter.Initialize(soundData[0]);
+
+	std::vector<DatasetType> block(4096);
+	size_t blockStart;
+	for (blockStart = 0; blockStart < soundData.GetNumberOfPoints(); blockStart += block.size())
+	{
+		const size_t blockLength(std::min(block.size(), soundData.GetNumberOfPoints() - blockStart));
+		filter.Process(soundData.GetSamples() + blockStart, block.data(), blockLength);
+
+		const auto minMax(std::minmax_element(block.begin(), block.begin() + blockLength));
+		minValue = std::min<double>(minValue, *minMax.first);
+		maxValue = std::max<double>(maxValue, *minMax.second);
+	}
+
+	if (maxValue > -minValue)
+		return maxValue;
+	return -minValue;
+}
@@ -6,8 +6,12 @@
 #ifndef NORMALIZER_H_
 #define NORMALIZER_H_
 
+// Local headers
+#include "soundDataView.h"
+
 // Local forward declarations
 class SoundData;
+class Filter;
 
 class Normalizer
 {
@@ -18,11 +22,12 @@ public:
 		PeakAWeighted// Approximation to equal-loudness curves in ISO 226
 	};
 
-	double ComputeGainFactor(const SoundData& soundData, double targetDecibels, const Method& method) const;
+	double ComputeGainFactor(const SoundDataView& soundData, double targetDecibels, const Method& method) const;
 	void Normalize(SoundData& soundData, const float& gainFactor) const;
 
 private:
-	double GetPeakAmplitude(const SoundData& soundData) const;
+	double GetPeakAmplitude(const SoundDataView& soundData) const;
+	double GetPeakAmplitude(const SoundDataView& soundData, Filter& filter) const;
 };
 
 #endif// NORMALIZER_H_
@@ -0,0 +1,120 @@
+// File:  polyphaseDecimator.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Low-pass filtering and downsampling by an integer factor.
+
+// Local headers
+#include "polyphaseDecimator.h"
+#include "firDesign.h"
+#include "threadPool.h"
+
+// Standard C++ headers
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+
+//=============================================================================
+// Class:			PolyphaseDecimator
+// Function:		PolyphaseDecimator
+//
+// Description:		Constructor for PolyphaseDecimator class.  Designs the
+//					anti-aliasing filter.  The transition band extends from
+//					the pass band edge to the lowest frequency which aliases
+//					into the pass band (the output sample rate minus the pass
+//					band edge), and the cutoff is placed at its center (the
+//					output Nyquist frequency).
+//
+// Input Arguments:
+//		factor			= const unsigned int&
+//		sampleRate		= const double& [Hz]
+//		passBandEdge	= const double& [Hz]
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+PolyphaseDecimator::PolyphaseDecimator(const unsigned int& factor, const double& sampleRate,
+	const double& passBandEdge) : factor(factor)
+{
+	assert(factor > 0);
+
+	const double outputRate(sampleRate / factor);
+	assert(passBandEdge < 0.5 * outputRate);
+	if (factor == 1)
+	{
+		taps.assign(1, 1.0f);
+		return;
+	}
+
+	// Transition width of the Blackman-windowed design is about 5.5 * sampleRate / order
+	const double transitionWidth(outputRate - 2.0 * passBandEdge);
+	const unsigned int order(static_cast<unsigned int>(ceil(5.5 * sampleRate / transitionWidth)));
+
+	const std::vector<double> impulseResponse(FIRDesign::LowPass(0.5 * outputRate, sampleRate, order));
+	taps.assign(impulseResponse.begin(), impulseResponse.end());
+}
+
+//=============================================================================
+// Class:			PolyphaseDecimator
+// Function:		Process
+//
+// Description:		Computes the filter output at every factor-th sample.
+//					Outputs are independent, so they are computed in
+//					parallel.  Because the filter is symmetric, each output
+//					is the dot product of the taps with the input samples
+//					centered on the output location.
+//
+// Input Arguments:
+//		input	= const DatasetType*
+//		count	= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::vector<DatasetType>
+//
+//=============================================================================
+std::vector<DatasetType> PolyphaseDecimator::Process(const DatasetType* input, const size_t& count) const
+{
+	const size_t outputCount((count + factor - 1) / factor);
+	std::vector<DatasetType> output(outputCount);
+	if (count == 0)
+		return output;
+
+	const size_t halfLength(taps.size() / 2);
+	ThreadPool& pool(ThreadPool::GetShared());
+	pool.ParallelFor(outputCount, pool.GetThreadCount(), [this, input, count, halfLength, &output](
+		const unsigned int&, const size_t& begin, const size_t& end)
+	{
+		std::vector<DatasetType> edge(taps.size());
+		size_t k, j;
+		for (k = begin; k < end; ++k)
+		{
+			const size_t center(k * factor);
+			const DatasetType* window;
+			if (center >= halfLength && center + halfLength < count)
+				window = input + center - halfLength;
+			else
+			{
+				// Near the ends, hold the first and last samples
+				for (j = 0; j < edge.size(); ++j)
+				{
+					const size_t index(std::min(std::max(center + j, halfLength) - halfLength, count - 1));
+					edge[j] = input[index];
+				}
+				window = edge.data();
+			}
+
+			double sum(0.0);
+			for (j = 0; j < taps.size(); ++j)
+				sum += taps[j] * window[j];
+			output[k] = static_cast<DatasetType>(sum);
+		}
+	});
+
+	return output;
+}
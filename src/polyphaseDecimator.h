@@ -0,0 +1,57 @@
+// File:  polyphaseDecimator.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Low-pass filtering and downsampling by an integer factor.
+
+#ifndef POLYPHASE_DECIMATOR_H_
+#define POLYPHASE_DECIMATOR_H_
+
+// Local headers
+#include "dataset2D.h"
+
+// Standard C++ headers
+#include <vector>
+
+/// Class for reducing the sample rate of a signal by an integer factor.  The
+/// signal is filtered with a linear-phase FIR anti-aliasing filter, but only
+/// the retained outputs are computed, so each input sample costs
+/// (number of taps) / (factor) multiplies, as with a polyphase
+/// implementation.  The filter delay is removed, so output sample k
+/// corresponds to input sample k * factor.  Samples beyond either end of the
+/// input are assumed to be equal to the first or last sample.
+class PolyphaseDecimator
+{
+public:
+	/// Constructor.
+	///
+	/// \param factor       Ratio of input to output sample rates.
+	/// \param sampleRate   Input sample rate <b>[Hz]</b>.
+	/// \param passBandEdge Highest frequency which must be preserved
+	///                     <b>[Hz]</b>.  Must be less than half of the
+	///                     output sample rate; frequencies which would alias
+	///                     into the band below this frequency are removed.
+	PolyphaseDecimator(const unsigned int& factor, const double& sampleRate,
+		const double& passBandEdge);
+
+	/// Filters and downsamples the specified signal.
+	///
+	/// \param input Samples to decimate.
+	/// \param count Number of points in \p input.
+	///
+	/// \returns The decimated signal, containing ceil(count / factor) points.
+	std::vector<DatasetType> Process(const DatasetType* input, const size_t& count) const;
+
+	/// \name Private data accessors
+	/// @{
+
+	unsigned int GetFactor() const { return factor; }
+	size_t GetNumberOfTaps() const { return taps.size(); }
+
+	/// @}
+
+private:
+	const unsigned int factor;
+	std::vector<DatasetType> taps;// Symmetric, with an odd number of taps
+};
+
+#endif// POLYPHASE_DECIMATOR_H_
@@ -0,0 +1,373 @@
+// File:  slidingDFT.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Spectrum of overlapping frames updated recursively as the frame slides.
+
+// Local headers
+#include "slidingDFT.h"
+
+// Standard C++ headers
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+
+//=============================================================================
+// Class:			SlidingDFT
+// Function:		SlidingDFT
+//
+// Description:		Constructor for SlidingDFT class.  A window with terms
+//					a[l] is the sum of a[l] / 2 * (exp(i * 2 * pi * l * m / P)
+//					+ exp(-i * 2 * pi * l * m / P)) for P = N - 1, so the
+//					windowed DFT at frequency f is the sum of the unwindowed
+//					DFTs at f + l / P weighted by a[|l|] / 2 (a[0] for l = 0).
+//					Phases are computed in double precision and reduced to a
+//					fraction of a cycle before being converted to radians.
+//
+// Input Arguments:
+//		windowSize		= const size_t&
+//		window			= const FastFourierTransform::WindowType&
+//		sampleRate		= const double& [Hz]
+//		minFrequency	= const double& [Hz]
+//		maxFrequency	= const double& [Hz]
+//		binCount		= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+SlidingDFT::SlidingDFT(const size_t& windowSize, const FastFourierTransform::WindowType& window,
+	const double& sampleRate, const double& minFrequency, const double& maxFrequency,
+	const size_t& binCount) : windowSize(windowSize), binCount(binCount), firstBinIsDC(minFrequency == 0.0)
+{
+	assert(windowSize > 1 && binCount > 0);
+	assert(maxFrequency > minFrequency);
+
+	std::vector<double> terms;
+	const bool isCosineSum(FastFourierTransform::GetCosineSumTerms(window, terms));
+	assert(isCosineSum);
+	(void)isCosineSum;
+
+	const int highestTerm(static_cast<int>(terms.size()) - 1);
+	const size_t termCount(2 * terms.size() - 1);
+	termWeights.resize(termCount);
+	int l;
+	for (l = -highestTerm; l <= highestTerm; ++l)
+		termWeights[l + highestTerm] = l == 0 ? terms[0] : 0.5 * terms[std::abs(l)];
+
+	const double spacing((maxFrequency - minFrequency) / binCount / sampleRate);
+	const double start(minFrequency / sampleRate);
+	const double termSpacing(1.0 / (windowSize - 1.0));
+
+	const size_t oscillatorCount(binCount * termCount);
+	stepReal.resize(oscillatorCount);
+	stepImaginary.resize(oscillatorCount);
+	entryReal.resize(oscillatorCount);
+	entryImaginary.resize(oscillatorCount);
+
+	size_t i, j;
+	for (i = 0; i < binCount; ++i)
+	{
+		for (j = 0; j < termCount; ++j)
+		{
+			const double frequency(start + spacing * i + termSpacing * (static_cast<int>(j) - highestTerm));// [cycles/sample]
+			const double stepAngle(2.0 * M_PI * (frequency - floor(frequency)));
+			const double entryCycles(frequency * windowSize);
+			const double entryAngle(-2.0 * M_PI * (entryCycles - floor(entryCycles)));
+
+			const size_t k(i * termCount + j);
+			stepReal[k] = cos(stepAngle);
+			stepImaginary[k] = sin(stepAngle);
+			entryReal[k] = cos(entryAngle);
+			entryImaginary[k] = sin(entryAngle);
+		}
+	}
+
+	// Rotations are powers of exp(-i * w) for each bin, accumulated together
+	// so the inner loop is independent for each bin
+	const auto windowCoefficients(FastFourierTransform::GetWindowCoefficients(window, windowSize));
+	windowSpectrumReal.assign(binCount, 0.0);
+	windowSpectrumImaginary.assign(binCount, 0.0);
+	std::vector<double> rotationReal(binCount, 1.0), rotationImaginary(binCount, 0.0);
+	std::vector<double> binStepReal(binCount), binStepImaginary(binCount);
+	for (i = 0; i < binCount; ++i)
+	{
+		const double frequency(start + spacing * i);// [cycles/sample]
+		const double angle(-2.0 * M_PI * (frequency - floor(frequency)));
+		binStepReal[i] = cos(angle);
+		binStepImaginary[i] = sin(angle);
+	}
+
+	size_t m;
+	for (m = 0; m < windowSize; ++m)
+	{
+		const double coefficient((*windowCoefficients)[m]);
+		for (i = 0; i < binCount; ++i)
+		{
+			windowSpectrumReal[i] += coefficient * rotationReal[i];
+			windowSpectrumImaginary[i] += coefficient * rotationImaginary[i];
+
+			const double nextReal(rotationReal[i] * binStepReal[i] - rotationImaginary[i] * binStepImaginary[i]);
+			rotationImaginary[i] = rotationReal[i] * binStepImaginary[i] + rotationImaginary[i] * binStepReal[i];
+			rotationReal[i] = nextReal;
+		}
+	}
+}
+
+SlidingDFT::Workspace::Workspace(const SlidingDFT& transform)
+	: real(transform.stepReal.size()), imaginary(transform.stepImaginary.size()),
+	rotationReal(transform.stepReal.size()), rotationImaginary(transform.stepImaginary.size())
+{
+}
+
+//=============================================================================
+// Class:			SlidingDFT
+// Function:		IsSupported (static)
+//
+// Description:		Returns true if the window can be applied in the
+//					frequency domain.
+//
+// Input Arguments:
+//		window	= const FastFourierTransform::WindowType&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		bool
+//
+//=============================================================================
+bool SlidingDFT::IsSupported(const FastFourierTransform::WindowType& window)
+{
+	std::vector<double> terms;
+	return FastFourierTransform::GetCosineSumTerms(window, terms);
+}
+
+//=============================================================================
+// Class:			SlidingDFT
+// Function:		ComputeCostPerFrame (static)
+//
+// Description:		Returns the approximate number of complex multiply-adds
+//					per frame.  Each unwindowed DFT requires two for each
+//					sample the frame advances, one more (amortized) for each
+//					sample to recompute it once per window, and one to form
+//					the windowed bins.
+//
+// Input Arguments:
+//		window		= const FastFourierTransform::WindowType&
+//		binCount	= const size_t&
+//		hopSize		= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		double
+//
+//=============================================================================
+double SlidingDFT::ComputeCostPerFrame(const FastFourierTransform::WindowType& window,
+	const size_t& binCount, const size_t& hopSize)
+{
+	std::vector<double> terms;
+	FastFourierTransform::GetCosineSumTerms(window, terms);
+	const double oscillatorCount(static_cast<double>(binCount) * (2 * terms.size() - 1));
+	return oscillatorCount * (3.0 * hopSize + 1.0);
+}
+
+//=============================================================================
+// Class:			SlidingDFT
+// Function:		Compute
+//
+// Description:		Computes the amplitude spectra of frameCount frames,
+//					beginning hopSize samples apart.  The first frame is
+//					computed directly, and each subsequent frame is computed
+//					from the previous frame until the frame has advanced by a
+//					full window.
+//
+// Input Arguments:
+//		samples			= const DatasetType*
+//		sampleCount		= const size_t&
+//		hopSize			= const size_t&
+//		frameCount		= const size_t&
+//		workspace		= Workspace&
+//		outputStride	= const size_t&
+//
+// Output Arguments:
+//		output			= DatasetType*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void SlidingDFT::Compute(const DatasetType* samples, const size_t& sampleCount,
+	const size_t& hopSize, const size_t& frameCount, Workspace& workspace,
+	DatasetType* output, const size_t& outputStride) const
+{
+	assert(hopSize > 0);
+	assert(outputStride >= binCount);
+	assert(workspace.real.size() == stepReal.size());
+
+	size_t i, advanced(0);
+	for (i = 0; i < frameCount; ++i)
+	{
+		DatasetType* frameOutput(output + i * outputStride);
+		const size_t start(i * hopSize);
+		if (start + windowSize > sampleCount)
+		{
+			std::fill(frameOutput, frameOutput + binCount, static_cast<DatasetType>(0.0));
+			continue;
+		}
+
+		if (i > 0 && advanced + hopSize < windowSize)
+		{
+			Advance(samples + start - hopSize, hopSize, workspace);
+			advanced += hopSize;
+		}
+		else
+		{
+			Initialize(samples + start, workspace);
+			advanced = 0;
+		}
+
+		ComputeAmplitudes(workspace, frameOutput);
+	}
+}
+
+//=============================================================================
+// Class:			SlidingDFT
+// Function:		Initialize
+//
+// Description:		Computes the unwindowed DFTs of the frame directly.
+//
+// Input Arguments:
+//		frame		= const DatasetType*, GetWindowSize() samples
+//
+// Output Arguments:
+//		workspace	= Workspace&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void SlidingDFT::Initialize(const DatasetType* frame, Workspace& workspace) const
+{
+	double* real(workspace.real.data());
+	double* imaginary(workspace.imaginary.data());
+	double* rotationReal(workspace.rotationReal.data());
+	double* rotationImaginary(workspace.rotationImaginary.data());
+	const size_t oscillatorCount(workspace.real.size());
+
+	// Rotations are powers of exp(-i * w) (the conjugate of the step); all
+	// DFTs are accumulated together, so the inner loop is independent for
+	// each DFT
+	std::fill(workspace.real.begin(), workspace.real.end(), 0.0);
+	std::fill(workspace.imaginary.begin(), workspace.imaginary.end(), 0.0);
+	std::fill(workspace.rotationReal.begin(), workspace.rotationReal.end(), 1.0);
+	std::fill(workspace.rotationImaginary.begin(), workspace.rotationImaginary.end(), 0.0);
+
+	workspace.sum = 0.0;
+	size_t k, m;
+	for (m = 0; m < windowSize; ++m)
+	{
+		const double sample(frame[m]);
+		for (k = 0; k < oscillatorCount; ++k)
+		{
+			real[k] += sample * rotationReal[k];
+			imaginary[k] += sample * rotationImaginary[k];
+
+			const double nextReal(rotationReal[k] * stepReal[k] + rotationImaginary[k] * stepImaginary[k]);
+			rotationImaginary[k] = rotationImaginary[k] * stepReal[k] - rotationReal[k] * stepImaginary[k];
+			rotationReal[k] = nextReal;
+		}
+
+		workspace.sum += sample;
+	}
+}
+
+//=============================================================================
+// Class:			SlidingDFT
+// Function:		Advance
+//
+// Description:		Updates the unwindowed DFTs as the frame advances by the
+//					specified number of samples.
+//
+// Input Arguments:
+//		frame		= const DatasetType*, start of the current frame (at
+//					  least GetWindowSize() + count samples)
+//		count		= const size_t&
+//		workspace	= Workspace&
+//
+// Output Arguments:
+//		workspace	= Workspace&
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void SlidingDFT::Advance(const DatasetType* frame, const size_t& count, Workspace& workspace) const
+{
+	double* real(workspace.real.data());
+	double* imaginary(workspace.imaginary.data());
+	const size_t oscillatorCount(workspace.real.size());
+
+	size_t i, k;
+	for (i = 0; i < count; ++i)
+	{
+		const double leaving(frame[i]);
+		const double entering(frame[i + windowSize]);
+		for (k = 0; k < oscillatorCount; ++k)
+		{
+			const double shiftedReal(real[k] - leaving + entering * entryReal[k]);
+			const double shiftedImaginary(imaginary[k] + entering * entryImaginary[k]);
+			real[k] = shiftedReal * stepReal[k] - shiftedImaginary * stepImaginary[k];
+			imaginary[k] = shiftedReal * stepImaginary[k] + shiftedImaginary * stepReal[k];
+		}
+
+		workspace.sum += entering - leaving;
+	}
+}
+
+//=============================================================================
+// Class:			SlidingDFT
+// Function:		ComputeAmplitudes
+//
+// Description:		Combines the unwindowed DFTs into the amplitude spectrum
+//					of the windowed, mean-removed frame.
+//
+// Input Arguments:
+//		workspace	= const Workspace&
+//
+// Output Arguments:
+//		output		= DatasetType*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void SlidingDFT::ComputeAmplitudes(const Workspace& workspace, DatasetType* output) const
+{
+	const size_t termCount(termWeights.size());
+	const double mean(workspace.sum / windowSize);
+	const double scale(2.0 / windowSize);
+
+	size_t i, j;
+	for (i = 0; i < binCount; ++i)
+	{
+		const double* real(workspace.real.data() + i * termCount);
+		const double* imaginary(workspace.imaginary.data() + i * termCount);
+		double binReal(-mean * windowSpectrumReal[i]);
+		double binImaginary(-mean * windowSpectrumImaginary[i]);
+		for (j = 0; j < termCount; ++j)
+		{
+			binReal += termWeights[j] * real[j];
+			binImaginary += termWeights[j] * imaginary[j];
+		}
+
+		output[i] = static_cast<DatasetType>(sqrt(binReal * binReal + binImaginary * binImaginary) * scale);
+	}
+
+	if (firstBinIsDC)
+		output[0] *= static_cast<DatasetType>(0.5);// No factor of 2 for DC point
+}
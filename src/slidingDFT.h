@@ -0,0 +1,139 @@
+// File:  slidingDFT.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Spectrum of overlapping frames updated recursively as the frame slides.
+
+#ifndef SLIDING_DFT_H_
+#define SLIDING_DFT_H_
+
+// Local headers
+#include "fft.h"
+
+// Standard C++ headers
+#include <vector>
+
+/// Class for computing the amplitude spectra of closely spaced frames at
+/// evenly spaced frequencies (like ChirpZTransform) by updating the DFT of
+/// the previous frame rather than transforming each frame.  For the N point
+/// frame beginning at sample n, the DFT at frequency w satisfies
+/// X(n + 1) = exp(i * w) * (X(n) - x[n] + x[n + N] * exp(-i * w * N)), so
+/// advancing by h samples costs O(h) per bin instead of O(N log N) for the
+/// whole frame.  This is only cheaper when frames overlap heavily.
+///
+/// The recursion requires an unwindowed DFT, so the window is applied in the
+/// frequency domain.  This is possible for windows which are sums of cosines
+/// with period N - 1 (see FastFourierTransform::GetCosineSumTerms()):  each
+/// term shifts the spectrum by a multiple of 1 / (N - 1) cycles per sample,
+/// so a window with L terms requires 2L - 1 unwindowed DFTs per bin.
+///
+/// Rounding errors accumulate in the recursion, so state is kept in double
+/// precision and the DFTs are recomputed directly each time the frame has
+/// advanced by a full window.
+///
+/// Tables are computed once by the constructor and are not modified, so a
+/// single object may be shared between threads; each caller must provide its
+/// own Workspace.
+class SlidingDFT
+{
+public:
+	/// Constructor.
+	///
+	/// \param windowSize    Number of samples in each frame.
+	/// \param window        Window function to apply to each frame (must be
+	///                      supported; see IsSupported()).
+	/// \param sampleRate    [Hz]
+	/// \param minFrequency  Frequency of the first bin [Hz].
+	/// \param maxFrequency  Upper edge of the band [Hz]; the last bin is one
+	///                      bin spacing below this frequency.
+	/// \param binCount      Number of frequency bins.
+	SlidingDFT(const size_t& windowSize, const FastFourierTransform::WindowType& window,
+		const double& sampleRate, const double& minFrequency, const double& maxFrequency,
+		const size_t& binCount);
+
+	/// Scratch buffers and recursion state used when computing frames.
+	struct Workspace
+	{
+		/// Constructor.
+		///
+		/// \param transform Transform with which this workspace will be used.
+		explicit Workspace(const SlidingDFT& transform);
+
+		std::vector<double> real;///< Real part of each unwindowed DFT
+		std::vector<double> imaginary;///< Imaginary part of each unwindowed DFT
+		double sum = 0.0;///< Sum of the samples in the current frame
+
+		std::vector<double> rotationReal;///< Direct computation buffer
+		std::vector<double> rotationImaginary;///< Direct computation buffer
+	};
+
+	/// Returns true if the specified window can be applied by this class.
+	///
+	/// \param window Type of window.
+	///
+	/// \returns True if the window is a sum of cosines.
+	static bool IsSupported(const FastFourierTransform::WindowType& window);
+
+	/// Returns the approximate number of complex multiply-adds required to
+	/// compute each frame, including the periodic direct recomputation.
+	///
+	/// \param window   Type of window.
+	/// \param binCount Number of frequency bins.
+	/// \param hopSize  Number of samples between the starts of adjacent
+	///                 frames.
+	///
+	/// \returns The cost per frame.
+	static double ComputeCostPerFrame(const FastFourierTransform::WindowType& window,
+		const size_t& binCount, const size_t& hopSize);
+
+	/// Computes the amplitude spectra of a series of frames (scaled the same
+	/// as ShortTimeFourierTransform).  The mean of each frame is removed
+	/// prior to windowing.  Frames which would extend beyond the end of the
+	/// sample buffer are filled with zeros.
+	///
+	/// \param samples      Sample buffer.
+	/// \param sampleCount  Number of points in \p samples.
+	/// \param hopSize      Number of samples between the starts of
+	///                     adjacent frames.
+	/// \param frameCount   Number of frames to compute.
+	/// \param workspace    Workspace created for this transform.
+	/// \param output       Output matrix; frame i bin j is written to
+	///                     output[i * outputStride + j].
+	/// \param outputStride Distance between the starts of adjacent frames in
+	///                     \p output (must be at least GetNumberOfBins()).
+	void Compute(const DatasetType* samples, const size_t& sampleCount,
+		const size_t& hopSize, const size_t& frameCount, Workspace& workspace,
+		DatasetType* output, const size_t& outputStride) const;
+
+	/// \name Private data accessors
+	/// @{
+
+	size_t GetWindowSize() const { return windowSize; }
+	size_t GetNumberOfBins() const { return binCount; }
+
+	/// @}
+
+private:
+	const size_t windowSize;
+	const size_t binCount;
+	const bool firstBinIsDC;
+
+	// Weight of each unwindowed DFT in the windowed bin (2L - 1 per bin, in
+	// order of increasing frequency)
+	std::vector<double> termWeights;
+
+	// For each unwindowed DFT (bin-major), exp(i * w) and exp(-i * w * N)
+	std::vector<double> stepReal;
+	std::vector<double> stepImaginary;
+	std::vector<double> entryReal;
+	std::vector<double> entryImaginary;
+
+	// Windowed DFT of a constant, used to remove the mean of each frame
+	std::vector<double> windowSpectrumReal;
+	std::vector<double> windowSpectrumImaginary;
+
+	void Initialize(const DatasetType* frame, Workspace& workspace) const;
+	void Advance(const DatasetType* frame, const size_t& count, Workspace& workspace) const;
+	void ComputeAmplitudes(const Workspace& workspace, DatasetType* output) const;
+};
+
+#endif// SLIDING_DFT_H_
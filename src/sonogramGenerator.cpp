@@ -6,18 +6,43 @@
 // Local headers
 #include "sonogramGenerator.h"
 #include "dataset2D.h"
+#include "stft.h"
+#include "threadPool.h"
+#include "polyphaseDecimator.h"
+#include "chirpZTransform.h"
+#include "slidingDFT.h"
 
 // wxWidgets headers
-#include <wx/bitmap.h>
-#include <wx/rawbmp.h>
+#include <wx/image.h>
 
 // Standard C++ headers
 #include <algorithm>
+#include <memory>
+#include <cmath>
 
-SonogramGenerator::SonogramGenerator(const SoundData& soundData,
-	const FFTParameters& parameters) : soundData(soundData), parameters(parameters)
+// Decimated sample rate relative to the maximum frequency; the excess over
+// 2.0 is the transition band of the anti-aliasing filter
+const double SonogramGenerator::minimumDecimatedRateRatio(2.5);
+
+const unsigned int SonogramGenerator::minimumDecimatedWindowSize(32);
+
+// Cost of one sliding DFT update (double precision) relative to one
+// operation of the vectorized single precision transforms (measured)
+const double SonogramGenerator::slidingDFTCostRatio(1.5);
+
+SonogramGenerator::SonogramGenerator(const SoundDataView& soundData,
+	const FFTParameters& parameters) : parameters(parameters), sampleRate(soundData.GetSampleRate()),
+	spectrum(ComputeSpectrum(soundData, parameters))
+{
+	ComputeFrequencyRange();
+}
+
+SonogramGenerator::SonogramGenerator(const std::shared_ptr<const MagnitudeMatrix>& spectrum,
+	const DatasetType& sampleRate, const FFTParameters& parameters) : parameters(parameters),
+	sampleRate(sampleRate), spectrum(spectrum)
 {
-	ComputeFrequencyInformation();
+	assert(spectrum->GetBinCount() == ComputeNumberOfBins(sampleRate, parameters));
+	ComputeFrequencyRange();
 }
 
 wxColor SonogramGenerator::ComputeContrastingMarkerColor(const ColorMap& m)
@@ -41,30 +66,86 @@ wxColor SonogramGenerator::ComputeContrastingMarkerColor(const ColorMap& m)
 	return wxColor(0, 0, 0);// white
 }
 
-wxImage SonogramGenerator::GetImage(ColorMap colorMap) const
+wxImage SonogramGenerator::GetImage(const ColorMap& colorMap) const
 {
-	std::sort(colorMap.begin(), colorMap.end());
-	
+	return GetImage(ColorTable(colorMap));
+}
+
+wxImage SonogramGenerator::GetImage(const ColorTable& colorTable) const
+{
+	// Image rows are frequency bins, so draw from a frequency-major copy to
+	// allow both the magnitudes and the pixels to be traversed sequentially
+	const MagnitudeMatrix byFrequency(spectrum->Transposed(firstBin, binCount));
+
+	DatasetType scale(0.0);
+	if (maxLogMagnitude > minLogMagnitude)
+		scale = 1.0 / (maxLogMagnitude - minLogMagnitude);
+
 	const unsigned int colorDepth(24);
-	wxImage sonogram(frequencyData.size(), frequencyData.front().size(), colorDepth);
-	wxImagePixelData pixels(sonogram);
-	int w;
-	for (w = 0; w < sonogram.GetWidth(); ++w)
+	wxImage sonogram(byFrequency.GetSliceCount(), byFrequency.GetBinCount(), colorDepth);
+	unsigned char* pixels(sonogram.GetData());
+	const size_t width(byFrequency.GetSliceCount());
+	const size_t height(byFrequency.GetBinCount());
+
+	ThreadPool& pool(ThreadPool::GetShared());
+	pool.ParallelFor(height, pool.GetThreadCount(), [&byFrequency, &colorTable, pixels, width, height, scale, this](
+		const unsigned int&, const size_t& begin, const size_t& end)
 	{
-		int h;
-		for (h = 0; h < sonogram.GetHeight(); ++h)
+		size_t h;
+		for (h = begin; h < end; ++h)
 		{
-			const wxColor c(GetColorFromMap(frequencyData[w][h], colorMap));
-			wxImagePixelData::Iterator p(pixels);
-			p.Offset(pixels, w, sonogram.GetHeight() - h - 1);
-			p.Red() = c.Red();
-			p.Green() = c.Green();
-			p.Blue() = c.Blue();
+			// Highest frequency is at the top of the image
+			colorTable.Colorize(byFrequency.GetRow(height - h - 1), width,
+				minLogMagnitude, scale, pixels + h * width * 3);
 		}
-	}
+	});
 
 	return sonogram;
 }
+
+const unsigned int SonogramGenerator::ColorTable::size(4096);
+
+SonogramGenerator::ColorTable::ColorTable(ColorMap colorMap) : table(size * 3)
+{
+	std::sort(colorMap.begin(), colorMap.end());
+
+	unsigned int i;
+	for (i = 0; i < size; ++i)
+	{
+		const wxColor c(GetScaledColorFromMap(static_cast<DatasetType>(i) / (size - 1), colorMap));
+		table[3 * i] = c.Red();
+		table[3 * i + 1] = c.Green();
+		table[3 * i + 2] = c.Blue();
+	}
+}
+
+void SonogramGenerator::ColorTable::Colorize(const DatasetType* values, const size_t& count,
+	const DatasetType& offset, const DatasetType& scale, unsigned char* rgb) const
+{
+	// Compute all of the indices first (this loop vectorizes), then gather the colors
+	const size_t blockSize(256);
+	unsigned int indices[blockSize];
+	const DatasetType maxIndex(size - 1);
+
+	size_t block, i;
+	for (block = 0; block < count; block += blockSize)
+	{
+		const size_t blockCount(std::min(blockSize, count - block));
+		for (i = 0; i < blockCount; ++i)
+		{
+			const DatasetType scaled((values[block + i] - offset) * scale * maxIndex + static_cast<DatasetType>(0.5));
+			indices[i] = static_cast<unsigned int>(std::min(std::max(scaled, static_cast<DatasetType>(0.0)), maxIndex));
+		}
+
+		for (i = 0; i < blockCount; ++i)
+		{
+			const unsigned char* color(table.data() + 3 * indices[i]);
+			*rgb++ = color[0];
+			*rgb++ = color[1];
+			*rgb++ = color[2];
+		}
+	}
+}
 #include <iostream>
 wxColor SonogramGenerator::GetScaledColorFromMap(const DatasetType& scaledMagnitude, const ColorMap& colorMap)
 {
@@ -84,12 +165,6 @@ wxColor SonogramGenerator::GetScaledColorFromMap(const DatasetType& scaledMagnit
 	return GetInterpolatedColor(lower.color, lower.magnitude, upper.color, upper.magnitude, scaledMagnitude);
 }
 
-wxColor SonogramGenerator::GetColorFromMap(const DatasetType& magnitude, const ColorMap& colorMap) const
-{
-	const DatasetType scaledMagnitude(GetScaledMagnitude(magnitude));
-	return GetScaledColorFromMap(scaledMagnitude, colorMap);
-}
-
 wxColor SonogramGenerator::GetInterpolatedColor(const wxColor& lowerColor, const double& lowerValue,
 	const wxColor& upperColor, const double& upperValue, const double& value)
 {
@@ -118,79 +193,172 @@ wxColor SonogramGenerator::GetInterpolatedColor(const wxColor& lowerColor, const
 		lowerV + (upperV - lowerV) * (value - lowerValue) / (upperValue - lowerValue));
 }
 
-DatasetType SonogramGenerator::GetScaledMagnitude(const DatasetType& magnitude) const
+std::shared_ptr<const MagnitudeMatrix> SonogramGenerator::ComputeSpectrum(
+	const SoundDataView& soundData, const FFTParameters& parameters)
 {
-	const float minRef(1.0e-10);
-	assert(maxMagnitude >= minMagnitude);
-	if (maxMagnitude == minMagnitude)
-		return 0.0;
-	return (log10(std::max(minRef, magnitude)) - log10(std::max(minRef, minMagnitude))) / (log10(maxMagnitude) - log10(std::max(minRef, minMagnitude)));
+	const unsigned int binCount(ComputeNumberOfBins(soundData.GetSampleRate(), parameters));
+	const unsigned int decimationFactor(ComputeDecimationFactor(soundData.GetSampleRate(), parameters));
+	if (decimationFactor == 1)
+		return ComputeMagnitudes(soundData, parameters, binCount);
+
+	// Bins above the maximum frequency would be discarded, so avoid computing them.
+	// The filter preserves the highest maximum frequency which selects this
+	// factor (rather than only the requested maximum frequency), so the
+	// spectrum depends only on the factor and can be reused for any frequency
+	// range which selects it.
+	const double passBandEdge(soundData.GetSampleRate() / (decimationFactor * minimumDecimatedRateRatio));
+	const PolyphaseDecimator decimator(decimationFactor, soundData.GetSampleRate(), passBandEdge);
+	const std::vector<DatasetType> decimated(decimator.Process(soundData.GetSamples(), soundData.GetNumberOfPoints()));
+
+	FFTParameters decimatedParameters(parameters);
+	decimatedParameters.windowSize /= decimationFactor;
+	return ComputeMagnitudes(SoundDataView(decimated.data(), decimated.size(),
+		soundData.GetSampleRate() / decimationFactor, soundData.GetDuration()), decimatedParameters, binCount);
 }
 
-void SonogramGenerator::ComputeFrequencyInformation()
+unsigned int SonogramGenerator::ComputeDecimationFactor(const DatasetType& sampleRate,
+	const FFTParameters& parameters)
 {
-	const DatasetType sliceWidth((parameters.windowSize + 1) / soundData.GetSampleRate());// [sec]
-	frequencyData.resize(ComputeNumberOfSlices());
+	// Powers of two dividing the window size, so the window size can be
+	// reduced by the same factor (and remain even)
+	unsigned int factor(1);
+	while (parameters.windowSize % (4 * factor) == 0 &&
+		parameters.windowSize / (2 * factor) >= minimumDecimatedWindowSize &&
+		sampleRate / (2 * factor) >= minimumDecimatedRateRatio * parameters.maxFrequency)
+		factor *= 2;
+
+	return factor;
+}
 
-	minMagnitude = std::numeric_limits<DatasetType>::max();
-	maxMagnitude = 0.0;
+unsigned int SonogramGenerator::ComputeNumberOfBins(const DatasetType& sampleRate,
+	const FFTParameters& parameters)
+{
+	if (parameters.bandLimited)
+		return parameters.windowSize / 2;
+	return parameters.windowSize / ComputeDecimationFactor(sampleRate, parameters) / 2 + 1;
+}
 
-	const double resolution(soundData.GetSampleRate() / parameters.windowSize);// [Hz]
-	const unsigned int minFrequencyIndex(parameters.minFrequency / resolution);
-	const unsigned int maxFrequencyIndex(parameters.maxFrequency / resolution);
-	assert(maxFrequencyIndex > minFrequencyIndex);
+std::shared_ptr<const MagnitudeMatrix> SonogramGenerator::ComputeMagnitudes(
+	const SoundDataView& soundData, const FFTParameters& parameters, const unsigned int& binCount)
+{
+	const size_t hopSize(ShortTimeFourierTransform::ComputeHopSize(parameters.windowSize, parameters.overlap));
+	const unsigned int sliceCount(ComputeNumberOfSlices(soundData, parameters.windowSize, hopSize));
+	auto magnitudes(std::make_shared<MagnitudeMatrix>(sliceCount, binCount));
 
-	DatasetType startTime(0.0);
-	const DatasetType startIncrement(sliceWidth * (1.0 - parameters.overlap));
-	for (auto& sliceFrequency : frequencyData)
+	std::unique_ptr<const SlidingDFT> slidingDFT;
+	std::unique_ptr<const ChirpZTransform> chirpZ;
+	if (UseSlidingDFT(parameters, binCount, hopSize))
+	{
+		// Full spectra are bins 0 through binCount - 1 at the FFT bin spacing
+		const double maxFrequency(parameters.bandLimited ? parameters.maxFrequency :
+			static_cast<double>(binCount) * soundData.GetSampleRate() / parameters.windowSize);
+		slidingDFT = std::make_unique<const SlidingDFT>(parameters.windowSize, parameters.windowFunction,
+			soundData.GetSampleRate(), parameters.bandLimited ? parameters.minFrequency : 0.0, maxFrequency, binCount);
+	}
+	else if (parameters.bandLimited)
+		chirpZ = std::make_unique<const ChirpZTransform>(parameters.windowSize, parameters.windowFunction,
+			soundData.GetSampleRate(), parameters.minFrequency, parameters.maxFrequency, binCount);
+
+	// Slices are independent, so each thread computes a contiguous range of
+	// slices with its own workspace (the plan itself is shared)
+	ThreadPool& pool(ThreadPool::GetShared());
+	pool.ParallelFor(sliceCount, pool.GetThreadCount(), [&soundData, &parameters, &magnitudes, &slidingDFT, &chirpZ, hopSize, binCount](
+		const unsigned int&, const size_t& begin, const size_t& end)
 	{
-		if (startTime >= soundData.GetDuration())
+		const size_t firstSample(begin * hopSize);
+		const size_t availableSamples(soundData.GetNumberOfPoints() - std::min(firstSample, soundData.GetNumberOfPoints()));
+		if (slidingDFT)
 		{
-			sliceFrequency = std::vector<DatasetType>(maxFrequencyIndex - minFrequencyIndex, 0.0);
-			minMagnitude = 0.0;
-			startTime += startIncrement;
-			continue;
+			SlidingDFT::Workspace workspace(*slidingDFT);
+			slidingDFT->Compute(soundData.GetSamples() + firstSample, availableSamples,
+				hopSize, end - begin, workspace, magnitudes->GetRow(begin), magnitudes->GetStride());
 		}
-
-		Dataset2D slice(soundData.ExtractSegment(startTime, std::min(startTime + sliceWidth, soundData.GetDuration()))->GetData());
-		if (slice.GetNumberOfPoints() < parameters.windowSize)
+		else if (chirpZ)
 		{
-			sliceFrequency = std::vector<DatasetType>(maxFrequencyIndex - minFrequencyIndex, 0.0);
-			minMagnitude = 0.0;
-			startTime += startIncrement;
-			continue;
+			ChirpZTransform::Workspace workspace(*chirpZ);
+			chirpZ->Compute(soundData.GetSamples() + firstSample, availableSamples,
+				hopSize, end - begin, workspace, magnitudes->GetRow(begin), magnitudes->GetStride());
+		}
+		else if (parameters.doublePrecision)
+		{
+			BasicShortTimeFourierTransform<double> stft(parameters.windowSize, parameters.windowFunction);
+			stft.Compute(soundData.GetSamples() + firstSample, availableSamples,
+				hopSize, end - begin, 0, binCount, magnitudes->GetRow(begin), magnitudes->GetStride());
 		}
-
-		startTime += startIncrement;
-		if (minFrequencyIndex == 0 && maxFrequencyIndex == slice.GetNumberOfPoints() - 1)
-			sliceFrequency = std::move(ComputeTimeSliceFFT(slice));
 		else
 		{
-			auto fftData(std::move(ComputeTimeSliceFFT(slice)));
-			sliceFrequency = std::vector<DatasetType>(fftData.begin() + minFrequencyIndex, fftData.begin() + maxFrequencyIndex);
+			ShortTimeFourierTransform stft(parameters.windowSize, parameters.windowFunction);
+			stft.Compute(soundData.GetSamples() + firstSample, availableSamples,
+				hopSize, end - begin, 0, binCount, magnitudes->GetRow(begin), magnitudes->GetStride());
 		}
 
-		const double maxElement(*std::max_element(sliceFrequency.begin(), sliceFrequency.end()));
-		if (maxElement > maxMagnitude)
-			maxMagnitude = maxElement;
+		// Store the logarithm once here, rather than for each pixel each time an image is drawn
+		const DatasetType minRef(1.0e-10);
+		size_t i, j;
+		for (i = begin; i < end; ++i)
+		{
+			DatasetType* slice(magnitudes->GetRow(i));
+			for (j = 0; j < binCount; ++j)
+				slice[j] = log10(std::max(minRef, slice[j]));
+		}
+	});
+
+	return magnitudes;
+}
 
-		const double minElement(*std::min_element(sliceFrequency.begin(), sliceFrequency.end()));
-		if (minElement < minMagnitude)
-			minMagnitude = minElement;
+void SonogramGenerator::ComputeFrequencyRange()
+{
+	if (parameters.bandLimited)
+	{
+		firstBin = 0;
+		binCount = spectrum->GetBinCount();
+		spectrum->ComputeRange(firstBin, binCount, minLogMagnitude, maxLogMagnitude);
+		return;
 	}
+
+	const double resolution(sampleRate / parameters.windowSize);// [Hz]
+	firstBin = parameters.minFrequency / resolution;
+	const unsigned int maxFrequencyIndex(parameters.maxFrequency / resolution);
+	assert(maxFrequencyIndex > firstBin);
+	assert(maxFrequencyIndex <= spectrum->GetBinCount());
+	binCount = maxFrequencyIndex - firstBin;
+
+	// Slices beyond the end of the data are zero-filled, so they are considered here, too
+	spectrum->ComputeRange(firstBin, binCount, minLogMagnitude, maxLogMagnitude);
 }
 
-unsigned int SonogramGenerator::ComputeNumberOfSlices() const
+bool SonogramGenerator::UseSlidingDFT(const FFTParameters& parameters,
+	const unsigned int& binCount, const size_t& hopSize)
 {
-	assert(soundData.GetDuration() * soundData.GetSampleRate() > parameters.windowSize);
-	return (soundData.GetDuration() * soundData.GetSampleRate() - parameters.windowSize)
-		/ (parameters.windowSize * (1.0 - parameters.overlap)) + 1;
+	if (!SlidingDFT::IsSupported(parameters.windowFunction))
+		return false;
+
+	// Transforms cost about N log2(N) per slice regardless of the hop, plus a
+	// few passes over the data; sliding DFT costs grow with the hop
+	double transformCost;
+	if (parameters.bandLimited)
+	{
+		// Two complex FFTs of the convolution size
+		const double size(ChirpZTransform::ComputeConvolutionSize(parameters.windowSize + binCount - 1));
+		transformCost = size * log2(size) + 3.0 * size;
+	}
+	else
+	{
+		// One complex FFT of half the window size
+		const double size(0.5 * parameters.windowSize);
+		transformCost = 0.5 * size * log2(size) + 4.0 * size;
+	}
+
+	return slidingDFTCostRatio * SlidingDFT::ComputeCostPerFrame(
+		parameters.windowFunction, binCount, hopSize) < transformCost;
 }
 
-std::vector<DatasetType> SonogramGenerator::ComputeTimeSliceFFT(const Dataset2D& sliceData) const
+unsigned int SonogramGenerator::ComputeNumberOfSlices(const SoundDataView& soundData,
+	const unsigned int& windowSize, const size_t& hopSize)
 {
-	return FastFourierTransform::ComputeFFT(sliceData,
-		parameters.windowFunction, parameters.windowSize, 0.0, true)->GetY();
+	assert(soundData.GetDuration() * soundData.GetSampleRate() > windowSize);
+	return (soundData.GetDuration() * soundData.GetSampleRate() - windowSize)
+		/ hopSize + 1;
 }
 
 void SonogramGenerator::GetHSV(const wxColor& c, double& hue, double& saturation, double& value)
@@ -7,8 +7,9 @@
 #define SONOGRAM_GENERATOR_H_
 
 // Local headers
-#include "soundData.h"
+#include "soundDataView.h"
 #include "fft.h"
+#include "magnitudeMatrix.h"
 
 // wxWidgets headers
 #include <wx/colour.h>
@@ -30,9 +31,39 @@ public:
 		double overlap;
 		double minFrequency;
 		double maxFrequency;
+		bool bandLimited;// Compute only the bins between min and max frequency (chirp-z transform)
+		bool doublePrecision;// Use double precision FFTs (slower; band-limited spectra are always single precision)
 	};
 
-	SonogramGenerator(const SoundData& soundData, const FFTParameters& parameters);
+	SonogramGenerator(const SoundDataView& soundData, const FFTParameters& parameters);
+
+	// Uses a spectrum previously returned by ComputeSpectrum() (i.e. from a cache)
+	// computed with the same window parameters; only the frequency range may differ
+	SonogramGenerator(const std::shared_ptr<const MagnitudeMatrix>& spectrum,
+		const DatasetType& sampleRate, const FFTParameters& parameters);
+
+	// Computes log10 of the magnitude of all bins from 0 to the Nyquist frequency
+	// (time-major), so the result can be reused for any frequency range with
+	// the same decimation factor.  When the maximum frequency is well below the
+	// Nyquist frequency, the data is decimated first and the window size is
+	// reduced by the same factor, so the frequency resolution is unchanged
+	// (the anti-aliasing filter depends only on the factor, not on the
+	// maximum frequency).
+	// For band-limited parameters, only the requested band is computed (with
+	// windowSize / 2 bins spread across the band, regardless of its width).
+	static std::shared_ptr<const MagnitudeMatrix> ComputeSpectrum(
+		const SoundDataView& soundData, const FFTParameters& parameters);
+
+	// Factor by which the sample rate is reduced prior to computing the
+	// spectrum (a power of two, one if no decimation is performed)
+	static unsigned int ComputeDecimationFactor(const DatasetType& sampleRate,
+		const FFTParameters& parameters);
+
+	// Number of bins in the spectrum returned by ComputeSpectrum()
+	static unsigned int ComputeNumberOfBins(const DatasetType& sampleRate,
+		const FFTParameters& parameters);
+
+	std::shared_ptr<const MagnitudeMatrix> GetSpectrum() const { return spectrum; }
 
 	struct MagnitudeColor
 	{
@@ -47,7 +78,28 @@ public:
 	};
 
 	typedef std::vector<MagnitudeColor> ColorMap;
-	wxImage GetImage(ColorMap colorMap) const;
+
+	// Colors for evenly spaced scaled magnitudes between 0 and 1, so coloring
+	// a pixel is a table lookup instead of a search and HSV interpolation.
+	// Only needs to be rebuilt when the color map changes.
+	class ColorTable
+	{
+	public:
+		explicit ColorTable(ColorMap colorMap);
+
+		static const unsigned int size;
+
+		// Writes 3 bytes (RGB) per value to rgb; values are scaled by
+		// (value - offset) * scale, then clamped to the range 0 to 1
+		void Colorize(const DatasetType* values, const size_t& count,
+			const DatasetType& offset, const DatasetType& scale, unsigned char* rgb) const;
+
+	private:
+		std::vector<unsigned char> table;// 3 bytes (RGB) per entry
+	};
+
+	wxImage GetImage(const ColorMap& colorMap) const;
+	wxImage GetImage(const ColorTable& colorTable) const;
 
 	static wxColor ComputeContrastingMarkerColor(const ColorMap& m);
 
@@ -57,20 +109,33 @@ public:
 	static wxColor GetScaledColorFromMap(const DatasetType& sclaedMagnitude, const ColorMap& colorMap);
 
 private:
-	const SoundData& soundData;
+	static const double minimumDecimatedRateRatio;
+	static const unsigned int minimumDecimatedWindowSize;
+	static const double slidingDFTCostRatio;
+
 	const FFTParameters parameters;
+	const DatasetType sampleRate;
+
+	std::shared_ptr<const MagnitudeMatrix> spectrum;// Time-major, log10 of magnitude, all bins (or the requested band)
+	unsigned int firstBin;
+	unsigned int binCount;
+
+	DatasetType minLogMagnitude;
+	DatasetType maxLogMagnitude;
 
-	DatasetType minMagnitude;
-	DatasetType maxMagnitude;
+	void ComputeFrequencyRange();
 
-	std::vector<std::vector<DatasetType>> frequencyData;// first index time, second index frequency
-	void ComputeFrequencyInformation();
-	std::vector<DatasetType> ComputeTimeSliceFFT(const Dataset2D& sliceData) const;
+	static std::shared_ptr<const MagnitudeMatrix> ComputeMagnitudes(
+		const SoundDataView& soundData, const FFTParameters& parameters,
+		const unsigned int& binCount);
 
-	DatasetType GetScaledMagnitude(const DatasetType& magnitude) const;
-	wxColor GetColorFromMap(const DatasetType& magnitude, const ColorMap& colorMap) const;
+	static unsigned int ComputeNumberOfSlices(const SoundDataView& soundData,
+		const unsigned int& windowSize, const size_t& hopSize);
 
-	unsigned int ComputeNumberOfSlices() const;
+	// True if updating each slice from the previous slice (sliding DFT) is
+	// expected to be cheaper than transforming each slice
+	static bool UseSlidingDFT(const FFTParameters& parameters,
+		const unsigned int& binCount, const size_t& hopSize);
 
 	static void GetHSV(const wxColor& c, double& hue, double& saturation, double& value);
 	static wxColor ColorFromHSV(const double& hue, const double& saturation, const double& value);
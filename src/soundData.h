@@ -8,9 +8,11 @@
 
 // Local headers
 #include "dataset2D.h"
+#include "soundDataView.h"
 
 // Standard C++ headers
 #include <memory>
+#include <vector>
 
 // Local forward declarations
 class Filter;
@@ -22,23 +24,30 @@ public:
 	SoundData(const DatasetType& sampleRate, const DatasetType& duration);
 	explicit SoundData(const SoundData& sd);
 	explicit SoundData(SoundData&& sd);
+	explicit SoundData(const SoundDataView& view);// Copies the viewed samples
 	SoundData& operator=(const SoundData& sd) = delete;
 	SoundData& operator=(SoundData&& sd) = delete;
 
-	std::unique_ptr<SoundData> ExtractSegment(const DatasetType& startTime, const DatasetType& endTime) const;
-	std::unique_ptr<SoundData> ApplyFilter(Filter& filter) const;
+	// Returned view refers to this object's data (no copy is made)
+	SoundDataView ExtractSegment(const DatasetType& startTime, const DatasetType& endTime) const;
+	std::unique_ptr<SoundData> ApplyFilter(const Filter& filter) const;
 
 	inline DatasetType GetSampleRate() const { return sampleRate; }
 	inline DatasetType GetDuration() const { return duration; }
-	inline const Dataset2D& GetData() const { return data; }
-	inline Dataset2D& GetData() { return data; }
+	inline size_t GetNumberOfPoints() const { return samples.size(); }
+	inline DatasetType GetTime(const size_t& i) const { return i / sampleRate; }// [sec]
+
+	// Time is implicit (index / sample rate), so only the amplitudes are stored
+	typedef std::vector<DatasetType> SampleBuffer;
+	inline const SampleBuffer& GetSamples() const { return samples; }
+	inline SampleBuffer& GetSamples() { return samples; }
 
 private:
 	friend AudioFile;
 
 	const DatasetType sampleRate;// [Hz]
 	const DatasetType duration;// [sec]
-	Dataset2D data;
+	SampleBuffer samples;
 };
 
 #endif// SOUND_DATA_H_
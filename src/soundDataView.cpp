@@ -0,0 +1,35 @@
+// File:  soundDataView.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Non-owning view of a range of samples within a SoundData object.
+
+// Local headers
+#include "soundDataView.h"
+#include "soundData.h"
+
+// Standard C++ headers
+#include <algorithm>
+
+SoundDataView::SoundDataView(const SoundData& soundData) : samples(soundData.GetSamples().data()),
+	sampleCount(soundData.GetNumberOfPoints()), sampleRate(soundData.GetSampleRate()),
+	duration(soundData.GetDuration()), startOffset(0)
+{
+}
+
+SoundDataView::SoundDataView(const DatasetType* samples, const size_t& sampleCount,
+	const DatasetType& sampleRate, const DatasetType& duration, const size_t& startOffset)
+	: samples(samples), sampleCount(sampleCount), sampleRate(sampleRate), duration(duration), startOffset(startOffset)
+{
+}
+
+SoundDataView SoundDataView::ExtractSegment(const DatasetType& startTime, const DatasetType& endTime) const
+{
+	assert(endTime > startTime);
+	const DatasetType segmentDuration(std::min(duration, endTime) - startTime);
+
+	// Because our data has a constant sample rate, we can calculate the indices
+	const size_t firstGoodIndex(std::min(static_cast<size_t>(startTime * sampleRate), sampleCount));
+	const size_t newPointCount(std::min(static_cast<size_t>(segmentDuration * sampleRate), sampleCount - firstGoodIndex));
+
+	return SoundDataView(samples + firstGoodIndex, newPointCount, sampleRate, segmentDuration, startOffset + firstGoodIndex);
+}
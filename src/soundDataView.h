@@ -0,0 +1,49 @@
+// File:  soundDataView.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Non-owning view of a range of samples within a SoundData object.
+
+#ifndef SOUND_DATA_VIEW_H_
+#define SOUND_DATA_VIEW_H_
+
+// Local headers
+#include "dataset2D.h"
+
+// Standard C++ headers
+#include <cassert>
+
+// Local forward declarations
+class SoundData;
+
+// Refers to (but does not own) a contiguous block of samples, so segments can
+// be passed around without copying.  A view is only valid as long as the
+// underlying SoundData object exists and is not resized.
+class SoundDataView
+{
+public:
+	SoundDataView(const SoundData& soundData);// Entire object
+	SoundDataView(const DatasetType* samples, const size_t& sampleCount,
+		const DatasetType& sampleRate, const DatasetType& duration, const size_t& startOffset = 0);
+
+	// Same range as SoundData::ExtractSegment(), but without copying (startTime is relative to this view)
+	SoundDataView ExtractSegment(const DatasetType& startTime, const DatasetType& endTime) const;
+
+	inline DatasetType GetSampleRate() const { return sampleRate; }
+	inline DatasetType GetDuration() const { return duration; }
+	inline size_t GetNumberOfPoints() const { return sampleCount; }
+	inline const DatasetType* GetSamples() const { return samples; }
+	inline size_t GetStartOffset() const { return startOffset; }// Index of first sample in the underlying data
+
+	inline const DatasetType& operator[](const size_t& i) const { assert(i < sampleCount); return samples[i]; }
+	inline const DatasetType* begin() const { return samples; }
+	inline const DatasetType* end() const { return samples + sampleCount; }
+
+private:
+	const DatasetType* samples;
+	size_t sampleCount;
+	DatasetType sampleRate;// [Hz]
+	DatasetType duration;// [sec]
+	size_t startOffset;
+};
+
+#endif// SOUND_DATA_VIEW_H_
@@ -0,0 +1,102 @@
+// File:  spectrumCache.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Cache of computed spectra, to avoid repeating FFTs when only display
+//        settings change.
+
+// Local headers
+#include "spectrumCache.h"
+
+SpectrumCache::SpectrumCache(const size_t& memoryBudget) : memoryBudget(memoryBudget)
+{
+}
+
+bool SpectrumCache::Key::operator==(const Key& k) const
+{
+	return dataHash == k.dataHash &&
+		startTime == k.startTime &&
+		endTime == k.endTime &&
+		windowFunction == k.windowFunction &&
+		windowSize == k.windowSize &&
+		overlap == k.overlap &&
+		decimationFactor == k.decimationFactor &&
+		bandLimited == k.bandLimited &&
+		minFrequency == k.minFrequency &&
+		maxFrequency == k.maxFrequency;
+}
+
+//=============================================================================
+// Class:			SpectrumCache
+// Function:		Find
+//
+// Description:		Returns the spectrum matching the specified key, if one
+//					is cached.  Matching entries become the most recently
+//					used.
+//
+// Input Arguments:
+//		key	= const Key&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		std::shared_ptr<const MagnitudeMatrix>, nullptr if not found
+//
+//=============================================================================
+std::shared_ptr<const MagnitudeMatrix> SpectrumCache::Find(const Key& key)
+{
+	for (auto it = entries.begin(); it != entries.end(); ++it)
+	{
+		if (it->first == key)
+		{
+			entries.splice(entries.begin(), entries, it);
+			return entries.front().second;
+		}
+	}
+
+	return nullptr;
+}
+
+//=============================================================================
+// Class:			SpectrumCache
+// Function:		Add
+//
+// Description:		Adds the specified spectrum to the cache and evicts the
+//					least recently used entries until the total size is
+//					within the memory budget.
+//
+// Input Arguments:
+//		key			= const Key&
+//		spectrum	= const std::shared_ptr<const MagnitudeMatrix>&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void SpectrumCache::Add(const Key& key, const std::shared_ptr<const MagnitudeMatrix>& spectrum)
+{
+	for (auto it = entries.begin(); it != entries.end(); ++it)
+	{
+		if (it->first == key)
+		{
+			entries.erase(it);
+			break;
+		}
+	}
+
+	entries.emplace_front(key, spectrum);
+
+	size_t totalSize(0);
+	auto it(entries.begin());
+	for (; it != entries.end(); ++it)
+	{
+		totalSize += it->second->GetMemorySize();
+		if (totalSize > memoryBudget && it != entries.begin())
+			break;
+	}
+
+	entries.erase(it, entries.end());
+}
@@ -0,0 +1,73 @@
+// File:  spectrumCache.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Cache of computed spectra, to avoid repeating FFTs when only display
+//        settings change.
+
+#ifndef SPECTRUM_CACHE_H_
+#define SPECTRUM_CACHE_H_
+
+// Local headers
+#include "magnitudeMatrix.h"
+#include "fft.h"
+
+// Standard C++ headers
+#include <list>
+#include <memory>
+
+/// Least-recently-used cache of full-band spectra.  Entries are identified by
+/// everything that affects the FFT results; settings which only affect how
+/// the spectrum is displayed (color map, frequency range) are not part of the
+/// key, so changing them reuses the cached spectrum.
+class SpectrumCache
+{
+public:
+	/// Constructor.
+	///
+	/// \param memoryBudget Maximum total size of cached spectra [bytes].  The
+	///                     most recently added spectrum is always retained,
+	///                     even if it alone exceeds the budget.
+	explicit SpectrumCache(const size_t& memoryBudget);
+
+	/// Structure identifying a spectrum.
+	struct Key
+	{
+		size_t dataHash;///< Identifies the (filtered and normalized) sound data
+		double startTime;///< [sec]
+		double endTime;///< [sec]
+		FastFourierTransform::WindowType windowFunction;
+		unsigned int windowSize;
+		double overlap;
+		unsigned int decimationFactor;
+		bool bandLimited;
+		double minFrequency;///< [Hz] Zero unless band-limited
+		double maxFrequency;///< [Hz] Zero unless band-limited
+
+		bool operator==(const Key& k) const;
+	};
+
+	/// Finds the spectrum matching the specified key.
+	///
+	/// \param key Identifier of the desired spectrum.
+	///
+	/// \returns The cached spectrum, or nullptr if no match was found.
+	std::shared_ptr<const MagnitudeMatrix> Find(const Key& key);
+
+	/// Adds a spectrum to the cache, removing the least recently used entries
+	/// as required to remain within the memory budget.
+	///
+	/// \param key      Identifier of the spectrum.
+	/// \param spectrum Spectrum to cache.
+	void Add(const Key& key, const std::shared_ptr<const MagnitudeMatrix>& spectrum);
+
+	/// Removes all entries.
+	void Clear() { entries.clear(); }
+
+private:
+	const size_t memoryBudget;// [bytes]
+
+	typedef std::pair<Key, std::shared_ptr<const MagnitudeMatrix>> Entry;
+	std::list<Entry> entries;// Most recently used at front
+};
+
+#endif// SPECTRUM_CACHE_H_
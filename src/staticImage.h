@@ -16,7 +16,7 @@ class StaticImage : public wxPanel
 {
 public:
 	StaticImage(wxWindow* parent, MainFrame& mainFrame, wxWindowID id, const unsigned int& width,
-		const unsigned int& height, const bool& hasFrequencyAxis);
+		const unsigned int& height, const bool& hasFrequencyAxis, const bool& hasTimeAxis);
 	void SetImage(wxImage&& newImage);
 	void Reset();
 	void ExportToFile(const wxString& fileName) const;
@@ -33,6 +33,7 @@ private:
 	int width = -1;
 	int height = -1;
 	const bool hasFrequencyAxis;
+	const bool hasTimeAxis;
 
 	wxColor markerColor = wxColor(255, 255, 255);
 	bool cursorVisible = false;
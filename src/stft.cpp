@@ -0,0 +1,196 @@
+// File:  stft.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Batched short-time Fourier transform.
+
+// Local headers
+#include "stft.h"
+
+// Standard C++ headers
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+#include <type_traits>
+
+template <typename T>
+BasicShortTimeFourierTransform<T>::BasicShortTimeFourierTransform(const size_t& windowSize,
+	const FastFourierTransform::WindowType& window) : plan(BasicFFTPlan<T>::Get(windowSize, window)),
+	workspace(*plan), frameBuffer(std::is_same<T, DatasetType>::value ? 0 : windowSize)
+{
+}
+
+//=============================================================================
+// Class:			BasicShortTimeFourierTransform
+// Function:		Compute
+//
+// Description:		Computes the single-sided amplitude spectra of frameCount
+//					frames, beginning hopSize samples apart.
+//
+// Input Arguments:
+//		samples			= const DatasetType*
+//		sampleCount		= const size_t&
+//		hopSize			= const size_t&
+//		frameCount		= const size_t&
+//		firstBin		= const size_t&
+//		binCount		= const size_t&
+//		outputStride	= const size_t&
+//
+// Output Arguments:
+//		output			= DatasetType*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicShortTimeFourierTransform<T>::Compute(const DatasetType* samples,
+	const size_t& sampleCount, const size_t& hopSize, const size_t& frameCount,
+	const size_t& firstBin, const size_t& binCount, DatasetType* output,
+	const size_t& outputStride)
+{
+	assert(hopSize > 0);
+	assert(outputStride >= binCount);
+
+	size_t i;
+	for (i = 0; i < frameCount; ++i)
+	{
+		DatasetType* frameOutput(output + i * outputStride);
+		const size_t start(i * hopSize);
+		if (start + GetWindowSize() > sampleCount)
+			std::fill(frameOutput, frameOutput + binCount, static_cast<DatasetType>(0.0));
+		else
+			ComputeFrame(samples + start, firstBin, binCount, frameOutput);
+	}
+}
+
+//=============================================================================
+// Class:			BasicShortTimeFourierTransform
+// Function:		ComputeFrame
+//
+// Description:		Computes the single-sided amplitude spectrum of one frame
+//					(bins firstBin through firstBin + binCount - 1).
+//
+// Input Arguments:
+//		frame		= const DatasetType*
+//		firstBin	= const size_t&
+//		binCount	= const size_t&
+//
+// Output Arguments:
+//		output		= DatasetType*
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+template <typename T>
+void BasicShortTimeFourierTransform<T>::ComputeFrame(const DatasetType* frame,
+	const size_t& firstBin, const size_t& binCount, DatasetType* output)
+{
+	assert(firstBin + binCount <= GetNumberOfBins());
+
+	const size_t windowSize(GetWindowSize());
+	double sum(0.0);
+	size_t i;
+	for (i = 0; i < windowSize; ++i)
+		sum += frame[i];
+
+	plan->Execute(ConvertFrame(frame), static_cast<T>(sum / windowSize), workspace);
+
+	const T scale(static_cast<T>(2.0) / windowSize);
+	const T* real(workspace.real.data() + firstBin);
+	const T* imaginary(workspace.imaginary.data() + firstBin);
+	for (i = 0; i < binCount; ++i)
+		output[i] = static_cast<DatasetType>(sqrt(real[i] * real[i] + imaginary[i] * imaginary[i]) * scale);
+
+	if (firstBin == 0 && binCount > 0)
+		output[0] *= static_cast<DatasetType>(0.5);// No factor of 2 for DC point
+}
+
+//=============================================================================
+// Class:			BasicShortTimeFourierTransform
+// Function:		ComputeNumberOfFrames (static)
+//
+// Description:		Returns the number of frames which fit entirely within a
+//					buffer of the specified length.
+//
+// Input Arguments:
+//		sampleCount	= const size_t&
+//		windowSize	= const size_t&
+//		hopSize		= const size_t&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		size_t
+//
+//=============================================================================
+template <typename T>
+size_t BasicShortTimeFourierTransform<T>::ComputeNumberOfFrames(const size_t& sampleCount,
+	const size_t& windowSize, const size_t& hopSize)
+{
+	assert(hopSize > 0);
+	if (sampleCount < windowSize)
+		return 0;
+	return (sampleCount - windowSize) / hopSize + 1;
+}
+
+//=============================================================================
+// Class:			BasicShortTimeFourierTransform
+// Function:		ComputeHopSize (static)
+//
+// Description:		Returns the number of samples between the starts of
+//					adjacent frames for the specified overlap.
+//
+// Input Arguments:
+//		windowSize	= const size_t&
+//		overlap		= const double&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		size_t
+//
+//=============================================================================
+template <typename T>
+size_t BasicShortTimeFourierTransform<T>::ComputeHopSize(const size_t& windowSize, const double& overlap)
+{
+	const double hop(floor(windowSize * (1.0 - overlap) + 0.5));
+	if (hop < 1.0)
+		return 1;
+	return static_cast<size_t>(hop);
+}
+
+//=============================================================================
+// Class:			BasicShortTimeFourierTransform
+// Function:		ConvertFrame
+//
+// Description:		Returns the frame converted to the precision of the FFT.
+//					No conversion is necessary for DatasetType.
+//
+// Input Arguments:
+//		frame	= const DatasetType*
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		const T*
+//
+//=============================================================================
+template <typename T>
+const T* BasicShortTimeFourierTransform<T>::ConvertFrame(const DatasetType* frame)
+{
+	std::copy(frame, frame + frameBuffer.size(), frameBuffer.begin());
+	return frameBuffer.data();
+}
+
+template <>
+const DatasetType* BasicShortTimeFourierTransform<DatasetType>::ConvertFrame(const DatasetType* frame)
+{
+	return frame;
+}
+
+template class BasicShortTimeFourierTransform<float>;
+template class BasicShortTimeFourierTransform<double>;
@@ -0,0 +1,105 @@
+// File:  stft.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Batched short-time Fourier transform.
+
+#ifndef STFT_H_
+#define STFT_H_
+
+// Local headers
+#include "fftPlan.h"
+
+// Standard C++ headers
+#include <memory>
+#include <vector>
+
+/// Class for computing the single-sided amplitude spectra of many
+/// (possibly overlapping) frames of a sample buffer in one call.  Frames are
+/// read directly from the caller's buffer and results are written directly
+/// to the caller's output matrix; the only scratch memory is the plan's
+/// workspace, which is allocated once and reused for every frame.  Each
+/// object owns its workspace, so threads must not share an object (they may,
+/// however, share the underlying plan).
+///
+/// Templated on the precision of the FFT.  Samples and results are always
+/// DatasetType; for other precisions, each frame is converted before it is
+/// transformed.
+template <typename T>
+class BasicShortTimeFourierTransform
+{
+public:
+	/// Constructor.
+	///
+	/// \param windowSize Number of samples in each frame (must be even).
+	/// \param window     Window function to apply to each frame.
+	BasicShortTimeFourierTransform(const size_t& windowSize,
+		const FastFourierTransform::WindowType& window);
+
+	/// Computes the amplitude spectra of a series of frames.  The mean of
+	/// each frame is removed prior to windowing.  Frames which would extend
+	/// beyond the end of the sample buffer are filled with zeros.
+	///
+	/// \param samples      Sample buffer.
+	/// \param sampleCount  Number of points in \p samples.
+	/// \param hopSize      Number of samples between the starts of
+	///                     adjacent frames.
+	/// \param frameCount   Number of frames to compute.
+	/// \param firstBin     Index of the first frequency bin to store.
+	/// \param binCount     Number of frequency bins to store for each frame.
+	/// \param output       Output matrix; frame i bin j is written to
+	///                     output[i * outputStride + j].
+	/// \param outputStride Distance between the starts of adjacent frames in
+	///                     \p output (must be at least \p binCount).
+	void Compute(const DatasetType* samples, const size_t& sampleCount,
+		const size_t& hopSize, const size_t& frameCount, const size_t& firstBin,
+		const size_t& binCount, DatasetType* output, const size_t& outputStride);
+
+	/// Computes the single-sided amplitude spectrum of one frame.
+	///
+	/// \param frame    Array of GetWindowSize() samples.
+	/// \param firstBin Index of the first frequency bin to store.
+	/// \param binCount Number of frequency bins to store.
+	/// \param output   Array of at least \p binCount elements.
+	void ComputeFrame(const DatasetType* frame, const size_t& firstBin,
+		const size_t& binCount, DatasetType* output);
+
+	/// Returns the number of frames which fit entirely within a buffer.
+	///
+	/// \param sampleCount Number of points in the buffer.
+	/// \param windowSize  Number of samples in each frame.
+	/// \param hopSize     Number of samples between the starts of adjacent
+	///                    frames.
+	///
+	/// \returns The number of complete frames.
+	static size_t ComputeNumberOfFrames(const size_t& sampleCount,
+		const size_t& windowSize, const size_t& hopSize);
+
+	/// Returns the hop size corresponding to the specified overlap.
+	///
+	/// \param windowSize Number of samples in each frame.
+	/// \param overlap    Fraction of each frame shared with the next frame.
+	///
+	/// \returns The number of samples between the starts of adjacent frames
+	///          (always at least one).
+	static size_t ComputeHopSize(const size_t& windowSize, const double& overlap);
+
+	/// \name Private data accessors
+	/// @{
+
+	size_t GetWindowSize() const { return plan->GetSize(); }
+	size_t GetNumberOfBins() const { return plan->GetNumberOfBins(); }
+
+	/// @}
+
+private:
+	const std::shared_ptr<const BasicFFTPlan<T>> plan;
+	typename BasicFFTPlan<T>::Workspace workspace;
+	std::vector<T> frameBuffer;// Converted frame (empty if T is DatasetType)
+
+	const T* ConvertFrame(const DatasetType* frame);
+};
+
+/// Transform using the same precision as the rest of the application.
+typedef BasicShortTimeFourierTransform<DatasetType> ShortTimeFourierTransform;
+
+#endif// STFT_H_
@@ -0,0 +1,154 @@
+// File:  threadPool.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Persistent pool of worker threads for data-parallel loops.
+
+// Local headers
+#include "threadPool.h"
+
+// Standard C++ headers
+#include <algorithm>
+#include <cassert>
+
+ThreadPool::ThreadPool(const unsigned int& threadCount)
+{
+	assert(threadCount > 0);
+	unsigned int i;
+	for (i = 0; i < threadCount; ++i)
+		threads.emplace_back(&ThreadPool::WorkerLoop, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+
+	taskCondition.notify_all();
+	for (auto& t : threads)
+		t.join();
+}
+
+//=============================================================================
+// Class:			ThreadPool
+// Function:		GetShared (static)
+//
+// Description:		Returns the application-wide pool, creating it on first
+//					use.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		ThreadPool&
+//
+//=============================================================================
+ThreadPool& ThreadPool::GetShared()
+{
+	static ThreadPool pool(std::max(1U, std::thread::hardware_concurrency()));
+	return pool;
+}
+
+//=============================================================================
+// Class:			ThreadPool
+// Function:		ParallelFor
+//
+// Description:		Splits the range [0, count) into contiguous chunks of
+//					(nearly) equal size and processes them on the worker
+//					threads.  Blocks until all chunks are complete.
+//
+// Input Arguments:
+//		count		= const size_t&
+//		chunkCount	= const unsigned int&
+//		function	= const ChunkFunction&
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		unsigned int, number of chunks used
+//
+//=============================================================================
+unsigned int ThreadPool::ParallelFor(const size_t& count, const unsigned int& chunkCount,
+	const ChunkFunction& function)
+{
+	if (count == 0)
+		return 0;
+
+	const unsigned int actualChunks(static_cast<unsigned int>(
+		std::max(static_cast<size_t>(1), std::min(count, static_cast<size_t>(chunkCount)))));
+	if (actualChunks == 1)
+	{
+		function(0, 0, count);
+		return 1;
+	}
+
+	std::mutex doneMutex;
+	std::condition_variable doneCondition;
+	unsigned int remaining(actualChunks);
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		unsigned int i;
+		for (i = 0; i < actualChunks; ++i)
+		{
+			const size_t begin(count * i / actualChunks);
+			const size_t end(count * (i + 1) / actualChunks);
+			tasks.push([&function, &doneMutex, &doneCondition, &remaining, i, begin, end]()
+			{
+				function(i, begin, end);
+
+				std::lock_guard<std::mutex> doneLock(doneMutex);
+				if (--remaining == 0)
+					doneCondition.notify_one();
+			});
+		}
+	}
+
+	taskCondition.notify_all();
+
+	std::unique_lock<std::mutex> doneLock(doneMutex);
+	doneCondition.wait(doneLock, [&remaining]() { return remaining == 0; });
+
+	return actualChunks;
+}
+
+//=============================================================================
+// Class:			ThreadPool
+// Function:		WorkerLoop
+//
+// Description:		Main loop for each worker thread.  Runs tasks as they are
+//					queued until the pool is destroyed.
+//
+// Input Arguments:
+//		None
+//
+// Output Arguments:
+//		None
+//
+// Return Value:
+//		None
+//
+//=============================================================================
+void ThreadPool::WorkerLoop()
+{
+	while (true)
+	{
+		std::function<void()> task;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			taskCondition.wait(lock, [this]() { return stopping || !tasks.empty(); });
+			if (stopping && tasks.empty())
+				return;
+
+			task = std::move(tasks.front());
+			tasks.pop();
+		}
+
+		task();
+	}
+}
@@ -0,0 +1,73 @@
+// File:  threadPool.h
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Persistent pool of worker threads for data-parallel loops.
+
+#ifndef THREAD_POOL_H_
+#define THREAD_POOL_H_
+
+// Standard C++ headers
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <queue>
+#include <vector>
+
+/// Class maintaining a fixed set of worker threads, so that parallel loops
+/// do not pay the cost of creating threads each time they are run.
+class ThreadPool
+{
+public:
+	/// Constructor.
+	///
+	/// \param threadCount Number of worker threads to create.
+	explicit ThreadPool(const unsigned int& threadCount);
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	/// Returns a pool shared by the entire application, with one thread for
+	/// each hardware thread.
+	static ThreadPool& GetShared();
+
+	/// Function called for each chunk of a parallel loop.  Arguments are the
+	/// index of the chunk, followed by the first index and one past the last
+	/// index of the range to process.
+	typedef std::function<void(const unsigned int&, const size_t&, const size_t&)> ChunkFunction;
+
+	/// Divides the range [0, count) into contiguous chunks and processes
+	/// them on the pool's threads, returning when all chunks are complete.
+	/// The division depends only on \p count and \p chunkCount, so results
+	/// do not depend on thread scheduling.  Must not be called from within a
+	/// chunk function.
+	///
+	/// \param count      Number of items to process.
+	/// \param chunkCount Number of chunks into which the range is divided
+	///                   (fewer are used if \p count is smaller).
+	/// \param function   Function to call for each chunk.
+	///
+	/// \returns The number of chunks actually used.
+	unsigned int ParallelFor(const size_t& count, const unsigned int& chunkCount,
+		const ChunkFunction& function);
+
+	/// \name Private data accessors
+	/// @{
+
+	unsigned int GetThreadCount() const { return static_cast<unsigned int>(threads.size()); }
+
+	/// @}
+
+private:
+	std::vector<std::thread> threads;
+	std::queue<std::function<void()>> tasks;
+
+	std::mutex mutex;
+	std::condition_variable taskCondition;
+	bool stopping = false;
+
+	void WorkerLoop();
+};
+
+#endif// THREAD_POOL_H_
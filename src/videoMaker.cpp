@@ -40,7 +40,7 @@ const int VideoMaker::footerHeight(24);
 const int VideoMaker::xAxisHeight(20);
 const int VideoMaker::yAxisWidth(20);
 
-wxImage VideoMaker::PrepareSonogram(const std::unique_ptr<SoundData>& soundData, const SonogramGenerator::FFTParameters& parameters,
+wxImage VideoMaker::PrepareSonogram(const SoundDataView& soundData, const SonogramGenerator::FFTParameters& parameters,
 	const SonogramGenerator::ColorMap& colorMap, wxImage& footer) const
 {
 	const unsigned int sonogramWidth(width - yAxisWidth);
@@ -48,7 +48,7 @@ wxImage VideoMaker::PrepareSonogram(const std::unique_ptr<SoundData>& soundData,
 	const unsigned int sonogramWithXAxisHeight(height - footerHeight);
 	
 	// Create the sonogram (one pixel for every FFT slice)
-	SonogramGenerator generator(*soundData, parameters);
+	SonogramGenerator generator(soundData, parameters);
 	auto wholeSonogram(generator.GetImage(colorMap));
 	wholeSonogram.Rescale(wholeSonogram.GetWidth(), sonogramHeight, wxIMAGE_QUALITY_HIGH);
 	
@@ -73,7 +73,7 @@ wxImage VideoMaker::PrepareSonogram(const std::unique_ptr<SoundData>& soundData,
 		dc.SetFont(labelFont);
 		dc.SetTextBackground(*wxWHITE);
 		dc.SetTextForeground(*wxBLACK);
-		const auto pixelsPerSecond(static_cast<int>(wholeSonogram.GetWidth() / soundData->GetDuration() + 0.5));
+		const auto pixelsPerSecond(static_cast<int>(wholeSonogram.GetWidth() / soundData.GetDuration() + 0.5));
 		
 		// Lines are exactly at the second mark; labels are to the left of the line
 		int time(0);
@@ -131,7 +131,7 @@ wxImage VideoMaker::CreateYAxisLabel(const SonogramGenerator::FFTParameters& par
 	return yAxisLabel.ConvertToImage();
 }
 
-bool VideoMaker::MakeVideo(const std::unique_ptr<SoundData>& soundData, const SonogramGenerator::FFTParameters& parameters,
+bool VideoMaker::MakeVideo(const SoundDataView& soundData, const SonogramGenerator::FFTParameters& parameters,
 	const SonogramGenerator::ColorMap& colorMap, const std::string& fileName)
 {
 	wxInitAllImageHandlers();
@@ -174,7 +174,7 @@ bool VideoMaker::MakeVideo(const std::unique_ptr<SoundData>& soundData, const So
 		return false;
 
 	AudioEncoder audioEncoder(errorStream);
-	if (!audioEncoder.Initialize(muxer.GetOutputFormatContext(), 1, soundData->GetSampleRate(), audioBitRate, AV_SAMPLE_FMT_FLTP, muxer.GetAudioCodecs().front()))
+	if (!audioEncoder.Initialize(muxer.GetOutputFormatContext(), 1, soundData.GetSampleRate(), audioBitRate, AV_SAMPLE_FMT_FLTP, muxer.GetAudioCodecs().front()))
 		return false;
 
 	std::queue<AVPacket*> encodedVideo;
@@ -187,11 +187,11 @@ bool VideoMaker::MakeVideo(const std::unique_ptr<SoundData>& soundData, const So
 
 	// Encode the video
 	double time(0.0);
-	const double secondsPerPixel(soundData->GetDuration() / (wholeSonogram.GetWidth() - width + yAxisWidth));
+	const double secondsPerPixel(soundData.GetDuration() / (wholeSonogram.GetWidth() - width + yAxisWidth));
 	const auto lineColor(SonogramGenerator::ComputeContrastingMarkerColor(colorMap));
 	while (true)
 	{
-		if (time <= soundData->GetDuration())
+		if (time <= soundData.GetDuration())
 		{
 			const auto image(GetFrameImage(wholeSonogram, baseFrame, maskedFooter, time, secondsPerPixel, lineColor));
 			ImageToAVFrame(image, videoEncoder.rgbFrame);
@@ -232,9 +232,9 @@ bool VideoMaker::MakeVideo(const std::unique_ptr<SoundData>& soundData, const So
 	unsigned int startSample(0);
 	while (true)
 	{
-		if (startSample <= soundData->GetData().GetNumberOfPoints())
+		if (startSample <= soundData.GetNumberOfPoints())
 		{
-			SoundToAVFrame(startSample, *soundData, audioEncoder.GetFrameSize(), audioEncoder.inputFrame);
+			SoundToAVFrame(startSample, soundData, audioEncoder.GetFrameSize(), audioEncoder.inputFrame);
 			startSample += audioEncoder.GetFrameSize();
 		}
 		else
@@ -294,16 +294,16 @@ void VideoMaker::ImageToAVFrame(const wxImage& image, AVFrame*& frame) const
 	av_image_fill_arrays(frame->data, frame->linesize, image.GetData(), AV_PIX_FMT_RGB24, width, height, align);
 }
 
-void VideoMaker::SoundToAVFrame(const unsigned int& startSample, const SoundData& soundData, const unsigned int& frameSize, AVFrame*& frame) const
+void VideoMaker::SoundToAVFrame(const unsigned int& startSample, const SoundDataView& soundData, const unsigned int& frameSize, AVFrame*& frame) const
 {
-	if (startSample + frameSize > soundData.GetData().GetNumberOfPoints())
+	if (startSample + frameSize > soundData.GetNumberOfPoints())
 	{
 		memset(frame->data[0], 0, frameSize * sizeof(float));
-		const auto valuesToCopy(soundData.GetData().GetNumberOfPoints() - startSample);
-		memcpy(frame->data[0], soundData.GetData().GetY().data() + startSample, valuesToCopy * sizeof(float));
+		const auto valuesToCopy(soundData.GetNumberOfPoints() - startSample);
+		memcpy(frame->data[0], soundData.GetSamples() + startSample, valuesToCopy * sizeof(float));
 	}
 	else
-		memcpy(frame->data[0], soundData.GetData().GetY().data() + startSample, frameSize * sizeof(float));
+		memcpy(frame->data[0], soundData.GetSamples() + startSample, frameSize * sizeof(float));
 }
 
 void VideoMaker::ComputeMaskedColor(const unsigned char& grey, const unsigned char& alpha, unsigned char& r, unsigned char& g, unsigned char& b)
@@ -37,7 +37,7 @@ public:
 	VideoMaker(const unsigned int& width, const unsigned int& height, unsigned int audioBitRate, unsigned int videoBitRate)
 		: width(width), height(height), audioBitRate(audioBitRate), videoBitRate(videoBitRate) {}
 
-	bool MakeVideo(const std::unique_ptr<SoundData>& soundData, const SonogramGenerator::FFTParameters& parameters,
+	bool MakeVideo(const SoundDataView& soundData, const SonogramGenerator::FFTParameters& parameters,
 		const SonogramGenerator::ColorMap& colorMap, const std::string& fileName);
 
 	const std::string GetErrorString() const { return errorString; }
@@ -54,7 +54,7 @@ private:
 	static const int xAxisHeight;
 	static const int yAxisWidth;
 
-	wxImage PrepareSonogram(const std::unique_ptr<SoundData>& soundData, const SonogramGenerator::FFTParameters& parameters,
+	wxImage PrepareSonogram(const SoundDataView& soundData, const SonogramGenerator::FFTParameters& parameters,
 		const SonogramGenerator::ColorMap& colorMap, wxImage& footer) const;
 	wxImage CreateYAxisLabel(const SonogramGenerator::FFTParameters& parameters);
 	wxImage GetFrameImage(const wxImage& wholeSonogram, const wxImage& baseFrame, const wxImage& maskedFooter,
@@ -65,7 +65,7 @@ private:
 	std::string errorString;
 
 	void ImageToAVFrame(const wxImage& image, AVFrame*& frame) const;
-	void SoundToAVFrame(const unsigned int& startSample, const SoundData& soundData, const unsigned int& frameSize, AVFrame*& frame) const;
+	void SoundToAVFrame(const unsigned int& startSample, const SoundDataView& soundData, const unsigned int& frameSize, AVFrame*& frame) const;
 	
 	static void FreeQueuedPackets(std::queue<AVPacket*>& q);
 };
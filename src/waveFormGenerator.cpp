@@ -5,13 +5,12 @@
 
 // Local headers
 #include "waveFormGenerator.h"
-#include "soundData.h"
 
 // wxWidgets headers
 #include <wx/image.h>
 #include <wx/dcmemory.h>
 
-WaveFormGenerator::WaveFormGenerator(const SoundData& soundData) : soundData(soundData)
+WaveFormGenerator::WaveFormGenerator(const SoundDataView& soundData) : soundData(soundData)
 {
 }
 
@@ -20,7 +19,7 @@ wxImage WaveFormGenerator::GetImage(const unsigned int& width, const unsigned in
 	const unsigned int colorDepth(24);
 	wxBitmap waveForm(width, height, colorDepth);
 
-	const double pointsPerSlice(static_cast<double>(soundData.GetData().GetNumberOfPoints()) / width);// [samples/px]
+	const double pointsPerSlice(static_cast<double>(soundData.GetNumberOfPoints()) / width);// [samples/px]
 	if (pointsPerSlice > 1.0)
 	{
 		// Create a list of points to create a polygon that describes the min/max within a slice
@@ -30,13 +29,13 @@ wxImage WaveFormGenerator::GetImage(const unsigned int& width, const unsigned in
 			double minValue(0.0), maxValue(0.0);
 			for (unsigned int j = 0; j < pointsPerSlice; ++j)
 			{
-				if (i * pointsPerSlice + j > soundData.GetData().GetNumberOfPoints())
+				if (i * pointsPerSlice + j >= soundData.GetNumberOfPoints())
 					break;
 
-				if (soundData.GetData().GetY()[i * pointsPerSlice + j] > maxValue)
-					maxValue = soundData.GetData().GetY()[i * pointsPerSlice + j];
-				else if (soundData.GetData().GetY()[i * pointsPerSlice + j] < minValue)
-					minValue = soundData.GetData().GetY()[i * pointsPerSlice + j];
+				if (soundData[i * pointsPerSlice + j] > maxValue)
+					maxValue = soundData[i * pointsPerSlice + j];
+				else if (soundData[i * pointsPerSlice + j] < minValue)
+					minValue = soundData[i * pointsPerSlice + j];
 			}
 
 			pointList[i] = wxPoint(i, height * 0.5 * (maxValue + 1.0));
@@ -70,9 +69,9 @@ wxImage WaveFormGenerator::GetImage(const unsigned int& width, const unsigned in
 			wxBrush brush(lineColor);
 			dc.SetBrush(brush);
 
-			for (unsigned int x = 1; x < soundData.GetData().GetNumberOfPoints(); ++x)
-				dc.DrawLine((x - 1) / pointsPerSlice + 0.5, height * 0.5 * (soundData.GetData().GetY()[x - 1] + 1.0),
-					x / pointsPerSlice + 0.5, height * 0.5 * (soundData.GetData().GetY()[x] + 1.0));
+			for (unsigned int x = 1; x < soundData.GetNumberOfPoints(); ++x)
+				dc.DrawLine((x - 1) / pointsPerSlice + 0.5, height * 0.5 * (soundData[x - 1] + 1.0),
+					x / pointsPerSlice + 0.5, height * 0.5 * (soundData[x] + 1.0));
 		}
 	}
 
@@ -9,8 +9,8 @@
 // wxWidgets headers
 #include <wx/colour.h>// Can't forward declare due to marcro (color vs. coulour)
 
-// Local forward declarations
-class SoundData;
+// Local headers
+#include "soundDataView.h"
 
 // wxWidgets forward declarations
 class wxImage;
@@ -18,12 +18,12 @@ class wxImage;
 class WaveFormGenerator
 {
 public:
-	WaveFormGenerator(const SoundData& soundData);
+	WaveFormGenerator(const SoundDataView& soundData);
 
 	wxImage GetImage(const unsigned int& width, const unsigned int& height, const wxColor& backgroundColor, const wxColor& lineColor) const;
 
 private:
-	const SoundData& soundData;
+	const SoundDataView soundData;
 };
 
 #endif// WAVE_FORM_GENERATOR_H_
@@ -0,0 +1,274 @@
+// File:  filterTests.cpp
+// Date:  10/16/2026
+// Auth:  K. Loux
+// Desc:  Regression tests for filter design, the filter pipeline and the
+//        anti-aliasing filter used when computing spectra.
+
+// Local headers
+#include "filter.h"
+#include "filterChain.h"
+#include "filterPipeline.h"
+#include "iirDesign.h"
+#include "soundData.h"
+#include "soundDataView.h"
+#include "sonogramGenerator.h"
+#include "magnitudeMatrix.h"
+
+// Standard C++ headers
+#include <iostream>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <string>
+#include <complex>
+
+namespace
+{
+
+const double pi(4.0 * std::atan(1.0));
+
+// First-order low-pass with the specified cutoff [Hz]
+Filter MakeLowPass(const double& sampleRate, const double& cutoff)
+{
+	return Filter(sampleRate, std::vector<double>(1, 1.0), { 1.0 / (2.0 * pi * cutoff), 1.0 });
+}
+
+std::shared_ptr<const SoundData> MakeTone(const double& sampleRate, const double& frequency)
+{
+	auto data(std::make_shared<SoundData>(sampleRate, 0.1));
+	size_t i;
+	for (i = 0; i < data->GetNumberOfPoints(); ++i)
+		data->GetSamples()[i] = static_cast<DatasetType>(std::sin(2.0 * pi * frequency * data->GetTime(i)));
+	return data;
+}
+
+bool SamplesMatch(const SoundData::SampleBuffer& a, const SoundData::SampleBuffer& b)
+{
+	if (a.size() != b.size())
+		return false;
+
+	size_t i;
+	for (i = 0; i < a.size(); ++i)
+	{
+		if (std::abs(a[i] - b[i]) > 1.0e-6)
+			return false;
+	}
+
+	return true;
+}
+
+// Loading data at a new sample rate with the same filter list must use the
+// filters designed for the new rate
+bool TestPipelineSampleRateChange()
+{
+	FilterPipeline pipeline(1 << 20);
+	const std::vector<bool> zeroPhase(1, false);
+	const std::vector<std::string> keys(1, "low-pass");
+
+	pipeline.SetInput(MakeTone(8000.0, 1000.0));
+	pipeline.SetFilters(std::vector<Filter>(1, MakeLowPass(8000.0, 500.0)), zeroPhase, keys);
+	pipeline.GetOutput();
+
+	const auto input(MakeTone(48000.0, 1000.0));
+	const std::vector<Filter> filters(1, MakeLowPass(48000.0, 500.0));
+	pipeline.SetInput(input);
+	pipeline.SetFilters(filters, zeroPhase, keys);
+
+	SoundData expected(*input);
+	FilterChain(filters, zeroPhase).Process(expected.GetSamples());
+	return SamplesMatch(pipeline.GetOutput()->GetSamples(), expected.GetSamples());
+}
+
+// Measures the gain of the filter at the specified frequency by filtering a
+// long sinusoid and comparing the amplitude after the transient has decayed
+double MeasureGain(Filter filter, const double& sampleRate, const double& frequency)
+{
+	std::vector<float> samples(static_cast<size_t>(2.0 * sampleRate));
+	size_t i;
+	for (i = 0; i < samples.size(); ++i)
+		samples[i] = static_cast<float>(std::sin(2.0 * pi * frequency * i / sampleRate));
+	filter.Initialize(0.0);
+	filter.Process(samples.data(), samples.data(), samples.size());
+
+	double sumSquares(0.0);
+	const size_t start(samples.size() * 3 / 4);
+	for (i = start; i < samples.size(); ++i)
+		sumSquares += samples[i] * samples[i];
+	return std::sqrt(2.0 * sumSquares / (samples.size() - start));
+}
+
+// Gain of the continuous-time band-pass prototype at the frequency which the
+// bilinear transform maps to the specified frequency
+double ComputeBandPassGain(const double& lowCutoff, const double& highCutoff,
+	const double& sampleRate, const unsigned int& order, const double& frequency)
+{
+	const unsigned int lowPassOrder(order / 2);
+	const std::complex<double> s(0.0, 2.0 * sampleRate * std::tan(pi * frequency / sampleRate));
+	std::complex<double> gain(std::pow(s / (2.0 * pi * highCutoff), order - lowPassOrder));
+	for (const auto& p : IIRDesign::GetButterworthPoles(lowPassOrder, 2.0 * pi * highCutoff))
+		gain *= -p / (s - p);
+	for (const auto& p : IIRDesign::GetButterworthPoles(order - lowPassOrder, 2.0 * pi * lowCutoff))
+		gain *= 2.0 * pi * highCutoff / (s - p);
+	return std::abs(gain);
+}
+
+// High-order Butterworth band-pass filters have tightly clustered poles,
+// which cannot be found accurately from the expanded polynomial
+bool TestHighOrderBandPass()
+{
+	const double sampleRate(44100.0);
+	const double center(1000.0);
+	const struct
+	{
+		double width;
+		unsigned int order;
+	} cases[] = { { 100.0, 32 }, { 100.0, 40 }, { 100.0, 60 }, { 500.0, 40 }, { 2000.0, 60 } };
+
+	bool passed(true);
+	for (const auto& c : cases)
+	{
+		const double highCutoff(center + 0.5 * c.width);
+		const double lowCutoff(center * center / highCutoff);
+		const Filter filter(IIRDesign::BandPass(lowCutoff, highCutoff, sampleRate, c.order, true, 1.0));
+		if (!filter.UsesSections() || filter.SectionDesignFailed())
+		{
+			std::cout << "  width " << c.width << " Hz, order " << c.order << ":  design failed" << std::endl;
+			passed = false;
+			continue;
+		}
+
+		for (const auto& f : { lowCutoff, center, highCutoff })
+		{
+			const double expected(20.0 * std::log10(ComputeBandPassGain(lowCutoff, highCutoff, sampleRate, c.order, f)));
+			const double actual(20.0 * std::log10(MeasureGain(filter, sampleRate, f)));
+			if (std::abs(actual - expected) > 0.1)
+			{
+				std::cout << "  width " << c.width << " Hz, order " << c.order << ", " << f << " Hz:  gain "
+					<< actual << " dB, expected " << expected << " dB" << std::endl;
+				passed = false;
+			}
+		}
+	}
+
+	return passed;
+}
+
+// Processing a direct-form filter in blocks of any size must continue from
+// the state left by the previous block and match Apply()
+bool TestDirectFormBlocks()
+{
+	const std::vector<double> impulseResponse({ 0.1, -0.2, 0.3, 0.4, 0.3, -0.2, 0.1 });
+	Filter perSample(Filter::FromImpulseResponse(8000.0, impulseResponse, 0.5));
+	Filter blocks(perSample);
+
+	std::vector<float> expected(100), actual(100);
+	size_t i;
+	for (i = 0; i < expected.size(); ++i)
+	{
+		actual[i] = static_cast<float>(std::sin(0.3 * i));
+		expected[i] = static_cast<float>(perSample.Apply(actual[i]));
+	}
+
+	const size_t blockSizes[] = { 1, 2, 3, 5, 8, 13, 21, 47 };
+	size_t start(0);
+	for (const auto& size : blockSizes)
+	{
+		blocks.Process(actual.data() + start, actual.data() + start, size);
+		start += size;
+	}
+
+	for (i = 0; i < expected.size(); ++i)
+	{
+		if (actual[i] != expected[i])
+		{
+			std::cout << "  sample " << i << ":  " << actual[i] << ", expected " << expected[i] << std::endl;
+			return false;
+		}
+	}
+
+	return blocks.GetRawValue() == perSample.GetRawValue() &&
+		blocks.GetFilteredValue() == perSample.GetFilteredValue();
+}
+
+// Level (log10 of the magnitude) of the specified bin in the middle slice of
+// the spectrum of a tone
+DatasetType ComputeToneLevel(const double& sampleRate, const double& frequency,
+	const SonogramGenerator::FFTParameters& parameters, const unsigned int& bin)
+{
+	const auto spectrum(SonogramGenerator::ComputeSpectrum(*MakeTone(sampleRate, frequency), parameters));
+	return (*spectrum)(spectrum->GetSliceCount() / 2, bin);
+}
+
+// Decimation must preserve the displayed band and reject frequencies which
+// alias into it, including those just above the decimated Nyquist frequency
+bool TestDecimationAntiAliasing()
+{
+	const double sampleRate(96000.0);
+	SonogramGenerator::FFTParameters parameters;
+	parameters.windowFunction = FastFourierTransform::WindowType::Hann;
+	parameters.windowSize = 4096;
+	parameters.overlap = 0.5;
+	parameters.minFrequency = 0.0;
+	parameters.maxFrequency = 4000.0;
+	parameters.bandLimited = false;
+	parameters.doublePrecision = false;
+	if (SonogramGenerator::ComputeDecimationFactor(sampleRate, parameters) != 8)
+	{
+		std::cout << "  unexpected decimation factor" << std::endl;
+		return false;
+	}
+
+	// Tones centered on bins, so the window does not attenuate them
+	const double binWidth(sampleRate / parameters.windowSize);
+	const unsigned int referenceBin(43), edgeBin(170), aliasBin(160);
+	const double decimatedRate(sampleRate / 8.0);
+	const DatasetType reference(ComputeToneLevel(sampleRate, referenceBin * binWidth, parameters, referenceBin));
+	const DatasetType edge(ComputeToneLevel(sampleRate, edgeBin * binWidth, parameters, edgeBin));
+	const DatasetType alias(ComputeToneLevel(sampleRate, decimatedRate - aliasBin * binWidth, parameters, aliasBin));
+
+	bool passed(true);
+	if (std::abs(20.0 * (edge - reference)) > 0.1)
+	{
+		std::cout << "  gain at " << edgeBin * binWidth << " Hz:  " << 20.0 * (edge - reference) << " dB" << std::endl;
+		passed = false;
+	}
+
+	if (20.0 * (alias - reference) > -60.0)
+	{
+		std::cout << "  alias of " << decimatedRate - aliasBin * binWidth << " Hz:  "
+			<< 20.0 * (alias - reference) << " dB" << std::endl;
+		passed = false;
+	}
+
+	return passed;
+}
+
+struct Test
+{
+	const char* name;
+	bool (*function)();
+};
+
+}// namespace
+
+int main()
+{
+	const Test tests[] =
+	{
+		{ "pipeline sample rate change", TestPipelineSampleRateChange },
+		{ "high-order band-pass", TestHighOrderBandPass },
+		{ "direct-form blocks", TestDirectFormBlocks },
+		{ "decimation anti-aliasing", TestDecimationAntiAliasing }
+	};
+
+	int failures(0);
+	for (const auto& t : tests)
+	{
+		const bool passed(t.function());
+		std::cout << (passed ? "PASS: " : "FAIL: ") << t.name << std::endl;
+		if (!passed)
+			++failures;
+	}
+
+	return failures;
+}